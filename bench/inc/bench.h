@@ -0,0 +1,91 @@
+// Copyright 2025-2026 ExoSpaceLabs
+// SPDX-License-Identifier: Apache-2.0
+
+#ifndef BENCH_H
+#define BENCH_H
+
+#include <CCSDSPack.h>
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace bench {
+
+  /**
+   * @brief Returns a deterministic, non repeating byte pattern of the given size.
+   *
+   * @param size number of bytes.
+   * @return the generated data.
+   */
+  inline std::vector<std::uint8_t> makeData(const std::size_t size) {
+    std::vector<std::uint8_t> data(size);
+    std::uint32_t state = 0x12345678;
+    for (auto &byte : data) {
+      state = state * 1664525u + 1013904223u; // LCG, keeps the data incompressible for the CRC.
+      byte = static_cast<std::uint8_t>(state >> 24);
+    }
+    return data;
+  }
+
+  /**
+   * @brief Returns the secondary header selected by a benchmark argument.
+   *
+   * @param index 0: PusA, 1: PusB, 2: PusC, 3: BufferHeader.
+   * @return the secondary header.
+   */
+  inline std::shared_ptr<CCSDS::SecondaryHeaderAbstract> makeSecondaryHeader(const std::int64_t index) {
+    switch (index) {
+      case 0: return std::make_shared<PusA>(0x2, 0x4, 0x5, 0x06, 0);
+      case 1: return std::make_shared<PusB>(0x2, 0x4, 0x5, 0x06, 0x0102, 0);
+      case 2: return std::make_shared<PusC>(0x2, 0x4, 0x5, 0x06, std::vector<std::uint8_t>{0x01, 0x02, 0x03, 0x04}, 0);
+      default: return std::make_shared<CCSDS::BufferHeader>(std::vector<std::uint8_t>{0xAA, 0xBB, 0xCC, 0xDD});
+    }
+  }
+
+  /**
+   * @brief Returns an unsegmented packet with the selected secondary header and application data.
+   *
+   * @param headerIndex secondary header, see makeSecondaryHeader().
+   * @param dataSize size of the application data in bytes.
+   * @return the packet, updated and ready to be serialized.
+   */
+  inline CCSDS::Packet makePacket(const std::int64_t headerIndex, const std::size_t dataSize) {
+    CCSDS::Packet packet;
+    (void) packet.setPrimaryHeader(std::vector<std::uint8_t>{0xCF, 0xF4, 0x00, 0x00, 0x00, 0x00});
+    packet.setDataFieldHeader(makeSecondaryHeader(headerIndex));
+    // the default data field limit is below the larger benchmark sizes.
+    packet.setDataFieldSize(static_cast<std::uint16_t>(dataSize + 64));
+    (void) packet.setApplicationData(makeData(dataSize));
+    packet.update();
+    return packet;
+  }
+
+  /**
+   * @brief Returns a buffer of serialized segmented packets built by the Manager.
+   *
+   * @param dataSize total application data in bytes.
+   * @param syncPattern whether to prefix each packet with the sync pattern.
+   * @return the packets buffer.
+   */
+  inline std::vector<std::uint8_t> makePacketsBuffer(const std::size_t dataSize, const bool syncPattern) {
+    CCSDS::Manager manager;
+    (void) manager.setPacketTemplate(makePacket(0, 0));
+    manager.setDataFieldSize(1024);
+    manager.setSyncPatternEnable(syncPattern);
+    (void) manager.setApplicationData(makeData(dataSize));
+    return manager.getPacketsBuffer();
+  }
+
+  /** @brief Returns the name of the secondary header selected by a benchmark argument. */
+  inline std::string secondaryHeaderName(const std::int64_t index) {
+    switch (index) {
+      case 0: return "PusA";
+      case 1: return "PusB";
+      case 2: return "PusC";
+      default: return "BufferHeader";
+    }
+  }
+}
+
+#endif // BENCH_H
@@ -0,0 +1,112 @@
+// Copyright 2025-2026 ExoSpaceLabs
+// SPDX-License-Identifier: Apache-2.0
+
+#include <benchmark/benchmark.h>
+#include "bench.h"
+
+namespace {
+
+  void BM_Crc16(benchmark::State &state) {
+    const auto data = bench::makeData(static_cast<std::size_t>(state.range(0)));
+    for (auto _ : state) {
+      benchmark::DoNotOptimize(crc16(data.data(), data.size()));
+    }
+    state.SetBytesProcessed(static_cast<std::int64_t>(state.iterations()) * state.range(0));
+  }
+  BENCHMARK(BM_Crc16)->RangeMultiplier(8)->Range(8, 64 << 10);
+
+  void BM_HeaderSerialize(benchmark::State &state) {
+    CCSDS::Header header;
+    header.setData(CCSDS::PrimaryHeader{0, 1, 1, 0x7F4, CCSDS::FIRST_SEGMENT, 1, 1024});
+    for (auto _ : state) {
+      benchmark::DoNotOptimize(header.serialize());
+    }
+  }
+  BENCHMARK(BM_HeaderSerialize);
+
+  void BM_HeaderDeserialize(benchmark::State &state) {
+    const std::vector<std::uint8_t> data{0x1F, 0xF4, 0x40, 0x01, 0x04, 0x00};
+    CCSDS::Header header;
+    for (auto _ : state) {
+      benchmark::DoNotOptimize(header.deserialize(data));
+    }
+  }
+  BENCHMARK(BM_HeaderDeserialize);
+
+  void BM_HeaderDecode(benchmark::State &state) {
+    const std::array<std::uint8_t, 6> data{0x1F, 0xF4, 0x40, 0x01, 0x04, 0x00};
+    for (auto _ : state) {
+      benchmark::DoNotOptimize(CCSDS::decodePrimaryHeader(data.data()));
+    }
+  }
+  BENCHMARK(BM_HeaderDecode);
+
+  void BM_PacketSerialize(benchmark::State &state) {
+    auto packet = bench::makePacket(state.range(0), static_cast<std::size_t>(state.range(1)));
+    for (auto _ : state) {
+      benchmark::DoNotOptimize(packet.serialize());
+    }
+    state.SetLabel(bench::secondaryHeaderName(state.range(0)));
+    state.SetBytesProcessed(static_cast<std::int64_t>(state.iterations() * packet.getFullPacketLength()));
+  }
+  BENCHMARK(BM_PacketSerialize)->ArgsProduct({{0, 1, 2, 3}, {64, 1024, 8192}});
+
+  void BM_PacketSerializeInto(benchmark::State &state) {
+    auto packet = bench::makePacket(state.range(0), static_cast<std::size_t>(state.range(1)));
+    std::vector<std::uint8_t> buffer(packet.getFullPacketLength());
+    for (auto _ : state) {
+      benchmark::DoNotOptimize(packet.serializeInto(buffer.data(), buffer.size()));
+    }
+    state.SetLabel(bench::secondaryHeaderName(state.range(0)));
+    state.SetBytesProcessed(static_cast<std::int64_t>(state.iterations() * buffer.size()));
+  }
+  BENCHMARK(BM_PacketSerializeInto)->ArgsProduct({{0, 1, 2, 3}, {64, 1024, 8192}});
+
+  void BM_PacketDeserialize(benchmark::State &state) {
+    auto source = bench::makePacket(state.range(0), static_cast<std::size_t>(state.range(1)));
+    const auto data = source.serialize();
+    const auto headerSize = source.getDataFieldHeaderBytes().size();
+    const auto headerType = bench::secondaryHeaderName(state.range(0));
+    for (auto _ : state) {
+      CCSDS::Packet packet;
+      packet.setDataFieldSize(source.getDataFieldMaximumSize());
+      // BufferHeader is not registered with the factory, it is deserialized by size.
+      if (headerType == "BufferHeader") {
+        benchmark::DoNotOptimize(packet.deserialize(data, static_cast<std::uint16_t>(headerSize)));
+      } else {
+        benchmark::DoNotOptimize(packet.deserialize(data, headerType, static_cast<std::int32_t>(headerSize)));
+      }
+    }
+    state.SetLabel(headerType);
+    state.SetBytesProcessed(static_cast<std::int64_t>(state.iterations() * data.size()));
+  }
+  BENCHMARK(BM_PacketDeserialize)->ArgsProduct({{0, 1, 2, 3}, {64, 1024, 8192}});
+
+  void BM_PacketConstruct(benchmark::State &state) {
+    for (auto _ : state) {
+      CCSDS::Packet packet;
+      benchmark::DoNotOptimize(packet);
+    }
+  }
+  BENCHMARK(BM_PacketConstruct);
+
+  void BM_PacketCopy(benchmark::State &state) {
+    const auto source = bench::makePacket(state.range(0), 64);
+    for (auto _ : state) {
+      CCSDS::Packet packet = source;
+      benchmark::DoNotOptimize(packet);
+    }
+    state.SetLabel(bench::secondaryHeaderName(state.range(0)));
+  }
+  BENCHMARK(BM_PacketCopy)->DenseRange(0, 3);
+
+  void BM_ErrorPath(benchmark::State &state) {
+    // a buffer shorter than a packet, every call returns an error.
+    const std::vector<std::uint8_t> data{0x1F, 0xF4, 0x40, 0x01, 0x04, 0x00};
+    CCSDS::PacketView view;
+    for (auto _ : state) {
+      benchmark::DoNotOptimize(view.deserialize(data.data(), data.size()));
+    }
+  }
+  BENCHMARK(BM_ErrorPath);
+}
@@ -0,0 +1,115 @@
+// Copyright 2025-2026 ExoSpaceLabs
+// SPDX-License-Identifier: Apache-2.0
+
+#include <benchmark/benchmark.h>
+#include "bench.h"
+
+namespace {
+
+  void BM_ManagerSetApplicationData(benchmark::State &state) {
+    const auto data = bench::makeData(static_cast<std::size_t>(state.range(0)));
+    const auto templatePacket = bench::makePacket(0, 0);
+    for (auto _ : state) {
+      CCSDS::Manager manager(templatePacket);
+      manager.setDataFieldSize(1024);
+      manager.setThreadCount(static_cast<std::uint32_t>(state.range(1)));
+      benchmark::DoNotOptimize(manager.setApplicationData(data));
+      benchmark::DoNotOptimize(manager.getPacketsBuffer());
+    }
+    state.SetBytesProcessed(static_cast<std::int64_t>(state.iterations()) * state.range(0));
+  }
+  BENCHMARK(BM_ManagerSetApplicationData)
+      ->ArgsProduct({{64 << 10, 1 << 20, 8 << 20}, {1, 0}})
+      ->ArgNames({"bytes", "threads"})
+      ->Unit(benchmark::kMillisecond);
+
+  void BM_ManagerLoad(benchmark::State &state) {
+    const bool syncPattern = state.range(1) != 0;
+    const auto buffer = bench::makePacketsBuffer(static_cast<std::size_t>(state.range(0)), syncPattern);
+    for (auto _ : state) {
+      CCSDS::Manager manager;
+      manager.setSyncPatternEnable(syncPattern);
+      benchmark::DoNotOptimize(manager.load(buffer));
+    }
+    state.SetBytesProcessed(static_cast<std::int64_t>(state.iterations() * buffer.size()));
+  }
+  BENCHMARK(BM_ManagerLoad)
+      ->ArgsProduct({{1 << 20, 8 << 20}, {0, 1}})
+      ->ArgNames({"bytes", "sync"})
+      ->Unit(benchmark::kMillisecond);
+
+  void BM_ManagerLoadPooled(benchmark::State &state) {
+    const auto buffer = bench::makePacketsBuffer(static_cast<std::size_t>(state.range(0)), false);
+    CCSDS::Manager manager;
+    // the pool is bounded by the packets of one capture, enough to reach a steady state without allocations.
+    (void) manager.load(buffer);
+    const std::size_t packetCount = manager.getTotalPackets();
+    manager.clearPackets();
+    manager.setPacketPoolSize(state.range(1) != 0 ? packetCount : 0);
+    for (auto _ : state) {
+      benchmark::DoNotOptimize(manager.load(buffer));
+      manager.clearPackets();
+    }
+    state.SetBytesProcessed(static_cast<std::int64_t>(state.iterations() * buffer.size()));
+  }
+  BENCHMARK(BM_ManagerLoadPooled)
+      ->ArgsProduct({{1 << 20, 8 << 20}, {0, 1}})
+      ->ArgNames({"bytes", "pool"})
+      ->Unit(benchmark::kMillisecond);
+
+  void BM_ManagerGetPacketViews(benchmark::State &state) {
+    const bool syncPattern = state.range(1) != 0;
+    const auto buffer = bench::makePacketsBuffer(static_cast<std::size_t>(state.range(0)), syncPattern);
+    std::vector<CCSDS::PacketView> views;
+    for (auto _ : state) {
+      views.clear(); // getPacketViews appends, the capacity is reused across iterations.
+      CCSDS::Manager manager;
+      manager.setSyncPatternEnable(syncPattern);
+      benchmark::DoNotOptimize(manager.getPacketViews(buffer.data(), buffer.size(), views));
+    }
+    state.SetBytesProcessed(static_cast<std::int64_t>(state.iterations() * buffer.size()));
+  }
+  BENCHMARK(BM_ManagerGetPacketViews)
+      ->ArgsProduct({{1 << 20, 8 << 20}, {0, 1}})
+      ->ArgNames({"bytes", "sync"})
+      ->Unit(benchmark::kMillisecond);
+
+  void BM_ManagerIndexPackets(benchmark::State &state) {
+    const auto buffer = bench::makePacketsBuffer(static_cast<std::size_t>(state.range(0)), false);
+    CCSDS::Manager manager;
+    CCSDS::PacketIndex index;
+    for (auto _ : state) {
+      index.clear();
+      benchmark::DoNotOptimize(manager.indexPackets(buffer.data(), buffer.size(), index));
+    }
+    state.SetBytesProcessed(static_cast<std::int64_t>(state.iterations() * buffer.size()));
+  }
+  BENCHMARK(BM_ManagerIndexPackets)->ArgName("bytes")->Arg(1 << 20)->Arg(8 << 20)->Unit(benchmark::kMillisecond);
+
+  void BM_ValidatorValidate(benchmark::State &state) {
+    auto packet = bench::makePacket(0, static_cast<std::size_t>(state.range(0)));
+    CCSDS::Validator validator(packet);
+    validator.configure(true, true, true);
+    for (auto _ : state) {
+      benchmark::DoNotOptimize(validator.validate(packet));
+    }
+    state.SetBytesProcessed(static_cast<std::int64_t>(state.iterations() * packet.getFullPacketLength()));
+  }
+  BENCHMARK(BM_ValidatorValidate)->Arg(64)->Arg(1024)->Arg(8192);
+
+  void BM_ValidatorValidateAll(benchmark::State &state) {
+    const auto buffer = bench::makePacketsBuffer(8 << 20, false);
+    std::vector<CCSDS::PacketView> views;
+    CCSDS::Manager manager;
+    (void) manager.getPacketViews(buffer.data(), buffer.size(), views);
+    CCSDS::Validator validator;
+    validator.configure(true, true, false);
+    validator.setThreadCount(static_cast<std::uint32_t>(state.range(0)));
+    for (auto _ : state) {
+      validator.clear();
+      benchmark::DoNotOptimize(validator.validateAll(views));
+    }
+    state.SetBytesProcessed(static_cast<std::int64_t>(state.iterations() * buffer.size()));
+  }
+  BENCHMARK(BM_ValidatorValidateAll)->ArgName("threads")->Arg(1)->Arg(0)->Unit(benchmark::kMillisecond);
+}
@@ -0,0 +1,52 @@
+# Copyright 2025-2026 ExoSpaceLabs
+# SPDX-License-Identifier: Apache-2.0
+
+set(BENCH_EXEC "${LIB_NAME}_bench")
+
+message(STATUS "Building: ${BENCH_EXEC}")
+
+find_package(benchmark REQUIRED)
+
+set(BENCH_SOURCE_DIR "${CMAKE_SOURCE_DIR}/bench/src")
+set(BENCH_INCLUDE_DIR "${CMAKE_SOURCE_DIR}/bench/inc")
+set(BENCH_RESULTS_DIR "${CMAKE_BINARY_DIR}/bench")
+
+# Collect all source files in the bench src folder for the benchmark executable
+file(GLOB BENCH_SOURCES "${BENCH_SOURCE_DIR}/*.cpp")
+
+# Create the benchmark executable target
+add_executable(${BENCH_EXEC} ${BENCH_SOURCES})
+
+# Add include directories to the benchmark target
+target_include_directories(${BENCH_EXEC} PRIVATE ${INCLUDE_DIR} ${BENCH_INCLUDE_DIR})
+
+# Link the benchmark executable with the library, main() is provided by benchmark_main
+target_link_libraries(${BENCH_EXEC} PRIVATE ${LIB_NAME} benchmark::benchmark benchmark::benchmark_main)
+
+# Set the output directory for the benchmark executable
+set_target_properties(${BENCH_EXEC} PROPERTIES
+        RUNTIME_OUTPUT_DIRECTORY ${BINARY_OUTPUT_DIR}          # Specifies where the executable is placed
+)
+
+# Platform-specific RPATH settings
+if(UNIX)
+    # Linux or macOS
+    set_target_properties(${BENCH_EXEC} PROPERTIES
+            BUILD_RPATH "/usr/local/lib:${LIBRARY_OUTPUT_DIR}:${CMAKE_BINARY_DIR}/lib"  # During build time, look in these paths for libraries
+            INSTALL_RPATH "/usr/local/lib:${LIBRARY_OUTPUT_DIR}:${CMAKE_BINARY_DIR}/lib" # After installation, look in these paths for libraries
+    )
+endif()
+
+# Runs the benchmarks and stores the results as JSON, named after the library version so releases can be compared.
+file(MAKE_DIRECTORY "${BENCH_RESULTS_DIR}")
+add_custom_target(${BENCH_EXEC}_json
+        COMMAND ${BENCH_EXEC}
+                --benchmark_out=${BENCH_RESULTS_DIR}/${LIB_VERSIONED}.json
+                --benchmark_out_format=json
+                --benchmark_repetitions=3
+                --benchmark_report_aggregates_only=true
+        DEPENDS ${BENCH_EXEC}
+        WORKING_DIRECTORY ${BINARY_OUTPUT_DIR}
+        COMMENT "Running ${BENCH_EXEC}, results in ${BENCH_RESULTS_DIR}/${LIB_VERSIONED}.json"
+        VERBATIM
+)
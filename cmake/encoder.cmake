@@ -22,6 +22,10 @@ target_include_directories(${ENCODER_EXEC} PRIVATE ${INCLUDE_DIR})
 # Link the encoder executable with the library
 target_link_libraries(${ENCODER_EXEC} PRIVATE ${LIB_NAME})
 
+# reader, packetizer and writer threads of the stream mode
+find_package(Threads REQUIRED)
+target_link_libraries(${ENCODER_EXEC} PRIVATE Threads::Threads)
+
 # Set the output directory for the encoder executable
 set_target_properties(${ENCODER_EXEC} PROPERTIES
     RUNTIME_OUTPUT_DIRECTORY ${BINARY_OUTPUT_DIR}          # Specifies where the executable is placed
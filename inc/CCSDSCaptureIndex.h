@@ -0,0 +1,285 @@
+// Copyright 2025-2026 ExoSpaceLabs
+// SPDX-License-Identifier: Apache-2.0
+
+#ifndef CCSDS_CAPTURE_INDEX_H
+#define CCSDS_CAPTURE_INDEX_H
+
+#include <CCSDSResult.h>
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+#include "CCSDSMappedFile.h"
+#include "CCSDSPacketView.h"
+
+namespace CCSDS {
+
+  /** @brief format version written to and expected in the capture index header. */
+  constexpr std::uint16_t kCaptureIndexVersion = 1;
+
+  /** @brief byte order mark of the capture index, read back reversed when written on a host of the other order. */
+  constexpr std::uint32_t kCaptureIndexByteOrder = 0x01020304;
+
+  /**
+   * @brief Header of a capture index file, followed by recordCount CaptureIndexRecord.
+   *
+   * Fields are stored in the byte order of the host that built the index, see byteOrder.
+   */
+  struct CaptureIndexHeader {
+    char magic[8];                  ///< "CCSDSIDX".
+    std::uint16_t version;          ///< kCaptureIndexVersion.
+    std::uint16_t recordSize;       ///< sizeof(CaptureIndexRecord).
+    std::uint32_t byteOrder;        ///< kCaptureIndexByteOrder.
+    std::uint64_t recordCount;      ///< number of indexed packets.
+    std::uint64_t captureSize;      ///< size of the indexed capture in bytes, detects stale indexes.
+    std::uint64_t skippedBytes;     ///< capture bytes skipped while resynchronising.
+    std::uint32_t syncPattern;      ///< sync pattern preceding each packet, if enabled.
+    std::uint8_t syncPatternEnable; ///< 1 if packets are preceded by the sync pattern.
+    std::uint8_t pusEnable;         ///< 1 if the PUS service, subtype and time code were indexed.
+    std::uint8_t timeCodeSize;      ///< bytes of the PUS-C time code indexed, 0 if none.
+    std::uint8_t reserved0;
+    std::uint8_t reserved[16];
+  };
+  static_assert(sizeof(CaptureIndexHeader) == 64, "capture index header layout must stay 64 bytes");
+
+  /**
+   * @brief Capture index entry of a single packet.
+   *
+   * Offsets locate the primary header, i.e. past the sync pattern. PUS fields are 0 when not indexed or
+   * when the packet has no secondary header.
+   */
+  struct CaptureIndexRecord {
+    std::uint64_t offset;           ///< byte offset of the primary header in the capture.
+    std::uint64_t timeCode;         ///< PUS-C time code as a big endian integer, 0 if not indexed.
+    std::uint16_t identification;   ///< first primary header word (version, type, secondary header flag, APID).
+    std::uint16_t sequenceControl;  ///< second primary header word (sequence flags and count).
+    std::uint16_t dataLength;       ///< third primary header word.
+    std::uint8_t service;           ///< PUS service type.
+    std::uint8_t subtype;           ///< PUS service subtype.
+
+    [[nodiscard]] std::uint16_t getAPID()          const { return identification & 0x07FF;  } ///< 11 bits
+    [[nodiscard]] std::uint8_t getSequenceFlags()  const { return sequenceControl >> 14;    } ///< 2 bits
+    [[nodiscard]] std::uint16_t getSequenceCount() const { return sequenceControl & 0x3FFF; } ///< 14 bits
+
+    /** @brief returns the full length of the packet in bytes, primary header and CRC included. */
+    [[nodiscard]] std::size_t getFullPacketLength() const { return static_cast<std::size_t>(dataLength) + 8; }
+  };
+  static_assert(sizeof(CaptureIndexRecord) == 24, "capture index record layout must stay 24 bytes");
+
+  /**
+   * @class CaptureIndexBuilder
+   * @brief Writes the sidecar index of a capture file in a single pass.
+   *
+   * The capture is mapped and framed with a StreamDecoder, the primary headers are decoded in batches and
+   * the records appended to the index file as they are produced, so the memory used does not depend on
+   * the size of the capture. A capture ending inside a packet is rejected and no index is left behind.
+   *
+   * Typical usage:
+   * @code
+   * CCSDS::CaptureIndexBuilder builder;
+   * builder.setSyncPatternEnable(true);
+   * builder.setPusEnable(true);
+   * builder.build("archive.bin", "archive.bin.idx");
+   * @endcode
+   *
+   * @note host only, not available when building for MCU.
+   */
+  class CaptureIndexBuilder {
+  public:
+    CaptureIndexBuilder() = default;
+
+    /**
+     * set sync pattern expected before each CCSDS packet.
+     *
+     * @param syncPattern std::uint32_t (default 0x1ACFFC1D)
+     */
+    void setSyncPattern(const std::uint32_t syncPattern) { m_syncPattern = syncPattern; }
+
+    /**
+     * enable sync pattern checking in front of each packet.
+     *
+     * @param enable bool (default false)
+     */
+    void setSyncPatternEnable(const bool enable) { m_syncPattEnable = enable; }
+
+    /**
+     * enable resynchronisation on sync pattern mismatch, see StreamDecoder::setResyncEnable().
+     *
+     * @param enable bool (default false)
+     */
+    void setResyncEnable(const bool enable) { m_resyncEnable = enable; }
+
+    /**
+     * enable indexing of the PUS service type, subtype and time code of packets with a secondary header.
+     *
+     * @param enable bool (default false)
+     */
+    void setPusEnable(const bool enable) { m_pusEnable = enable; }
+
+    /**
+     * @brief Sets the size of the PUS-C time code following the source ID, 0 for PUS-A and PUS-B packets.
+     *
+     * @param timeCodeSize time code bytes (default 0, at most 8).
+     * @return ResultBool, error if the time code exceeds 8 bytes.
+     */
+    [[nodiscard]] ResultBool setTimeCodeSize(std::uint8_t timeCodeSize);
+
+    /**
+     * @brief Indexes a capture file.
+     *
+     * @param captureFile path of the capture.
+     * @param indexFile path of the index written, overwritten if present.
+     * @return ResultBool, error if a file cannot be accessed, on sync pattern mismatch or truncated capture.
+     */
+    [[nodiscard]] ResultBool build(const std::string &captureFile, const std::string &indexFile);
+
+    /**
+     * @brief Indexes a capture held in memory, see the file overload.
+     *
+     * @param pData pointer to the capture.
+     * @param sizeData size of the capture in bytes.
+     * @param indexFile path of the index written, overwritten if present.
+     * @return ResultBool
+     */
+    [[nodiscard]] ResultBool build(const std::uint8_t *pData, std::size_t sizeData, const std::string &indexFile);
+
+    /** @brief returns the number of packets indexed by the last build. */
+    [[nodiscard]] std::uint64_t getPacketCount() const { return m_packetCount; }
+
+    /** @brief returns the number of corrupt regions skipped by the last build. */
+    [[nodiscard]] std::uint64_t getSkippedRegions() const { return m_skippedRegions; }
+
+    /** @brief returns the number of bytes skipped by the last build. */
+    [[nodiscard]] std::uint64_t getSkippedBytes() const { return m_skippedBytes; }
+
+  private:
+    /** @brief fills the records of a batch of located packets. */
+    void fillRecords(const std::uint8_t *pData, const std::vector<std::uint64_t> &offsets);
+
+    std::uint32_t m_syncPattern{0x1ACFFC1D};
+    bool m_syncPattEnable{false};
+    bool m_resyncEnable{false};
+    bool m_pusEnable{false};
+    std::uint8_t m_timeCodeSize{0};
+    std::uint64_t m_packetCount{0};
+    std::uint64_t m_skippedRegions{0};
+    std::uint64_t m_skippedBytes{0};
+    std::vector<CaptureIndexRecord> m_records{};  ///< batch being written.
+    std::vector<std::uint16_t> m_identification{};
+    std::vector<std::uint16_t> m_sequenceControl{};
+    std::vector<std::uint16_t> m_dataLength{};
+  };
+
+  /**
+   * @class CaptureIndexReader
+   * @brief Random access into a capture through its memory mapped sidecar index.
+   *
+   * Records are served straight from the mapped index, a lookup only touches the page holding the record
+   * and, through getPacket(), the pages of the packet itself. Both files are advised for random access so
+   * the kernel does not read ahead the rest of a large capture.
+   *
+   * Typical usage:
+   * @code
+   * CCSDS::CaptureIndexReader reader;
+   * reader.open("archive.bin.idx");
+   * reader.openCapture("archive.bin");
+   * CCSDS::PacketView view;
+   * for (const auto row : reader.selectAPID(0x123)) {
+   *   reader.getPacket(row, view);
+   * }
+   * @endcode
+   *
+   * @note host only, not available when building for MCU.
+   */
+  class CaptureIndexReader {
+  public:
+    CaptureIndexReader() = default;
+
+    /**
+     * @brief Maps an index file, closing any previously opened one.
+     *
+     * @param indexFile path of the index.
+     * @return ResultBool, error if the file is not an index of this version and byte order or is truncated.
+     */
+    [[nodiscard]] ResultBool open(const std::string &indexFile);
+
+    /**
+     * @brief Maps the capture described by the opened index, to be accessed through getPacket().
+     *
+     * @param captureFile path of the capture.
+     * @return ResultBool, error if no index is open or the capture size differs from the indexed one.
+     */
+    [[nodiscard]] ResultBool openCapture(const std::string &captureFile);
+
+    /** @brief unmaps the index and the capture. */
+    void close();
+
+    /** @brief returns the header of the opened index. */
+    [[nodiscard]] const CaptureIndexHeader &getHeader() const { return m_header; }
+
+    /** @brief returns the number of indexed packets. */
+    [[nodiscard]] std::size_t size() const { return m_size; }
+
+    /** @brief returns true if no packet is indexed. */
+    [[nodiscard]] bool empty() const { return m_size == 0; }
+
+    /** @brief returns the record of a row, unchecked. */
+    [[nodiscard]] const CaptureIndexRecord &operator[](const std::size_t row) const { return m_records[row]; }
+
+    /** @brief returns the first record, records are in capture order. */
+    [[nodiscard]] const CaptureIndexRecord *begin() const { return m_records; }
+
+    /** @brief returns past the last record. */
+    [[nodiscard]] const CaptureIndexRecord *end() const { return m_records + m_size; }
+
+    /**
+     * @brief returns the record of a row.
+     *
+     * @param row position of the packet in the capture.
+     * @return Result holding the record, error if the row is out of range.
+     */
+    [[nodiscard]] Result<CaptureIndexRecord> getRecord(std::size_t row) const;
+
+    /** @brief returns the number of packets of the given APID. */
+    [[nodiscard]] std::size_t countAPID(std::uint16_t apid) const;
+
+    /**
+     * @brief returns the rows of the packets of the given APID within a range of rows.
+     *
+     * @param apid 11 bits application process identifier.
+     * @param first first row scanned (default 0).
+     * @param last past the last row scanned, clamped to size() (default all rows).
+     */
+    [[nodiscard]] std::vector<std::size_t> selectAPID(std::uint16_t apid, std::size_t first = 0,
+                                                      std::size_t last = SIZE_MAX) const;
+
+    /**
+     * @brief returns the first row with a time code not less than the given one.
+     *
+     * The search is binary, the time codes must be non decreasing in capture order. Two calls bound the
+     * rows of a time window.
+     *
+     * @param timeCode time code as a big endian integer, see CaptureIndexRecord::timeCode.
+     */
+    [[nodiscard]] std::size_t lowerBoundTimeCode(std::uint64_t timeCode) const;
+
+    /**
+     * @brief Points a view at the packet of a row in the mapped capture.
+     *
+     * @param row position of the packet in the capture.
+     * @param view set to the packet, valid while the capture stays open.
+     * @return ResultBool, error if no capture is open, the row is out of range or the packet exceeds the capture.
+     */
+    [[nodiscard]] ResultBool getPacket(std::size_t row, PacketView &view) const;
+
+  private:
+    MappedFile m_index{};
+    MappedFile m_capture{};
+    CaptureIndexHeader m_header{};
+    const CaptureIndexRecord *m_records{nullptr}; ///< records of the mapped index.
+    std::size_t m_size{0};
+  };
+
+} // namespace CCSDS
+
+#endif // CCSDS_CAPTURE_INDEX_H
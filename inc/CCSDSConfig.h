@@ -6,6 +6,7 @@
 
 #include <string>
 #include <cstdint>
+#include <cstdio>
 #include <vector>
 #include "CCSDSResult.h"
 #include <unordered_map>
@@ -22,12 +23,12 @@ public:
   template<typename T>
   CCSDS::Result<T> get(const std::string& key) const {
     auto it = values.find(key);
-    RET_IF_ERR_MSG(it == values.end(), CCSDS::ErrorCode::NO_DATA,"Config: No data found for key: " + key);
+    RET_IF_ERR_MSG(it == values.end(), CCSDS::ErrorCode::NO_DATA,"Config: No data found for key");
 
     if (const auto* p = std::get_if<T>(&it->second)) {
       return *p;
     }
-    return CCSDS::Error{ CCSDS::ErrorCode::INVALID_DATA, "Config: Wrong type for key: " + key};
+    return CCSDS::Error{ CCSDS::ErrorCode::INVALID_DATA, "Config: Wrong type for key"};
   }
 
   bool isKey(const std::string& key) const;
@@ -43,6 +44,19 @@ private:
 };
 
 
-
+/**
+ * @def ASSIGN_CONFIG_OR_PRINT(var, cfg, type, key)
+ * @brief Macro to assign the value of a config key or print an error message naming the key.
+ */
+#define ASSIGN_CONFIG_OR_PRINT(var, cfg, type, key) \
+do {                                                \
+    auto&& _res = (cfg).get<type>(key);             \
+    if (!_res) {                                    \
+        printf("[ Error ]: Code [%u]: %s: %s\n", static_cast<unsigned>(_res.error().code()), \
+               _res.error().message().c_str(), std::string(key).c_str()); \
+    } else {                                        \
+        var = std::move(_res.value());              \
+    }                                               \
+} while (0)
 
 #endif // CCSDS_CONFIG_H
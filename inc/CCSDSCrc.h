@@ -0,0 +1,159 @@
+// Copyright 2025-2026 ExoSpaceLabs
+// SPDX-License-Identifier: Apache-2.0
+
+#ifndef CCSDS_CRC_H
+#define CCSDS_CRC_H
+
+#include <cstddef>
+#include <cstdint>
+
+namespace CCSDS {
+
+  /** Configuration structure for CRC16 calculation parameters */
+  struct CRC16Config {
+    std::uint16_t polynomial = 0x1021;
+    std::uint16_t initialValue = 0xFFFF;
+    std::uint16_t finalXorValue = 0x0000;
+  };
+
+  /**
+   * @brief Table driven CRC-16 engine (MSB first, non reflected) for a single polynomial.
+   *
+   * Engines are built once per polynomial and cached for the lifetime of the process, so the
+   * lookup tables are only computed the first time a polynomial is used. Small inputs are
+   * processed one byte at a time, larger inputs with slicing-by-8 and, when the CPU supports
+   * carry-less multiplication (x86 PCLMULQDQ or ARMv8 PMULL), large inputs are folded 64 bytes
+   * at a time. All paths produce the same result as the bitwise reference algorithm.
+   *
+   * @note MCU builds keep a single 256 entry table per polynomial and skip the folding kernel.
+   */
+  class CRC16Engine {
+  public:
+    /**
+     * @brief Returns the cached engine for the given polynomial, building it on first use.
+     *
+     * @param polynomial CRC-16 polynomial without the implicit x^16 term.
+     * @return Reference to an engine valid for the lifetime of the process.
+     */
+    static const CRC16Engine &get(std::uint16_t polynomial);
+
+    /**
+     * @brief Runs the CRC register over the given bytes.
+     *
+     * No final XOR is applied, so the returned register can be fed back as the initial value
+     * of a following call to continue the computation over a split buffer.
+     *
+     * @param pData pointer to the data.
+     * @param sizeData number of bytes to process.
+     * @param initialValue value of the CRC register before the first byte.
+     * @return CRC register after the last byte.
+     */
+    [[nodiscard]] std::uint16_t compute(const std::uint8_t *pData, std::size_t sizeData,
+                                        std::uint16_t initialValue) const;
+
+    /**
+     * @brief Advances a CRC register over zero bytes without processing them.
+     *
+     * Computes crc * x^(8 * zeroBytes) mod P using precomputed powers, in O(log zeroBytes).
+     *
+     * @param crc CRC register.
+     * @param zeroBytes number of zero bytes to advance over.
+     * @return CRC register after the zero bytes.
+     */
+    [[nodiscard]] std::uint16_t shift(std::uint16_t crc, std::size_t zeroBytes) const;
+
+    /**
+     * @brief Combines the registers of two consecutive segments computed independently.
+     *
+     * @param crcFirst register after the first segment, with any initial value.
+     * @param crcSecond register of the second segment computed with a zero initial value.
+     * @param sizeSecond number of bytes of the second segment.
+     * @return register after both segments, as if computed in one pass from crcFirst's initial value.
+     */
+    [[nodiscard]] std::uint16_t combine(std::uint16_t crcFirst, std::uint16_t crcSecond, std::size_t sizeSecond) const {
+      return static_cast<std::uint16_t>(shift(crcFirst, sizeSecond) ^ crcSecond);
+    }
+
+    /** @brief returns the polynomial this engine was built for. */
+    [[nodiscard]] std::uint16_t getPolynomial() const { return m_polynomial; }
+
+    explicit CRC16Engine(std::uint16_t polynomial);
+
+  private:
+#ifdef CCSDS_MCU
+    static constexpr std::size_t kSlices = 1;
+#else
+    static constexpr std::size_t kSlices = 8;
+#endif
+
+    /** @brief processes bytes one at a time using the first table. */
+    [[nodiscard]] std::uint16_t computeBytewise(const std::uint8_t *pData, std::size_t sizeData,
+                                                std::uint16_t crc) const;
+
+    /** @brief processes 8 bytes per iteration, remaining bytes are handled bytewise. */
+    [[nodiscard]] std::uint16_t computeSliced(const std::uint8_t *pData, std::size_t sizeData,
+                                              std::uint16_t crc) const;
+
+    std::uint16_t m_polynomial;                ///< polynomial without the implicit x^16 term.
+    std::uint16_t m_table[kSlices][256]{};     ///< m_table[k][b]: CRC of byte b followed by k zero bytes.
+    std::uint64_t m_foldConstants[8]{};        ///< x^n mod P for n = 128, 192, 256, 320, 384, 448, 512, 576.
+    std::uint16_t m_shiftPowers[64]{};         ///< x^(8 * 2^i) mod P, advances a register over 2^i zero bytes.
+  };
+
+  /**
+   * @brief Running CRC-16 over a byte sequence that can be extended, combined and patched.
+   *
+   * The state keeps the CRC register and the number of bytes it covers, so data can be appended as
+   * it arrives, two independently computed segments can be joined, and a byte range can be replaced
+   * with work proportional to the replaced range rather than to the whole sequence.
+   */
+  class CRC16State {
+  public:
+    explicit CRC16State(const CRC16Config &config = {});
+
+    /** @brief restarts the state from the configured initial value, covering no bytes. */
+    void reset();
+
+    /** @brief extends the sequence with sizeData bytes. */
+    void append(const std::uint8_t *pData, std::size_t sizeData);
+
+    /**
+     * @brief extends the sequence with a segment whose CRC was computed independently.
+     *
+     * @param segment state computed with the same configuration as this one.
+     */
+    void append(const CRC16State &segment);
+
+    /**
+     * @brief updates the CRC for a byte range of the sequence being replaced.
+     *
+     * @param offset position of the first replaced byte.
+     * @param pOld bytes currently in the range.
+     * @param pNew bytes replacing them.
+     * @param sizeData size of the range.
+     * @return false if the range is not within the covered bytes, the state is then unchanged.
+     */
+    bool patch(std::size_t offset, const std::uint8_t *pOld, const std::uint8_t *pNew, std::size_t sizeData);
+
+    /** @brief returns the CRC of the covered bytes, final XOR applied. */
+    [[nodiscard]] std::uint16_t getValue() const { return m_register ^ m_config.finalXorValue; }
+
+    /** @brief returns the CRC register, without final XOR. */
+    [[nodiscard]] std::uint16_t getRegister() const { return m_register; }
+
+    /** @brief returns the number of bytes covered by the state. */
+    [[nodiscard]] std::size_t getSize() const { return m_size; }
+
+    /** @brief returns the configuration of the state. */
+    [[nodiscard]] const CRC16Config &getConfig() const { return m_config; }
+
+  private:
+    const CRC16Engine *m_engine;               ///< cached engine for the configured polynomial.
+    CRC16Config m_config;                      ///< polynomial, initial and final XOR values.
+    std::uint16_t m_register;                  ///< CRC register after the covered bytes.
+    std::size_t m_size{0};                     ///< number of covered bytes.
+  };
+
+}
+
+#endif // CCSDS_CRC_H
@@ -7,11 +7,106 @@
 #include <CCSDSResult.h>
 #include <vector>
 #include <memory>
+#include <variant>
 #include "CCSDSSecondaryHeaderAbstract.h"
 #include "CCSDSSecondaryHeaderFactory.h"
 #include "PusServices.h"
 
 namespace CCSDS {
+  /**
+   * @brief Holds the secondary header of a data field.
+   *
+   * Fixed size PUS headers (PusA, PusB) are stored inline, other headers are owned through a shared pointer.
+   * Copies and moves point the header at their own inline storage, so copying a data field copies an inline
+   * header instead of sharing it. share() moves an inline header to shared storage, so pointers handed out of
+   * the data field always own the header.
+   */
+  class SecondaryHeaderSlot {
+  public:
+    SecondaryHeaderSlot() = default;
+    ~SecondaryHeaderSlot() = default;
+
+    SecondaryHeaderSlot(const SecondaryHeaderSlot &other) : m_inline(other.m_inline), m_owned(other.m_owned) {
+      rebind();
+    }
+
+    SecondaryHeaderSlot(SecondaryHeaderSlot &&other) noexcept : m_inline(std::move(other.m_inline)),
+                                                                m_owned(std::move(other.m_owned)) {
+      rebind();
+      other.rebind();
+    }
+
+    SecondaryHeaderSlot &operator=(const SecondaryHeaderSlot &other) {
+      if (this != &other) {
+        m_inline = other.m_inline;
+        m_owned = other.m_owned;
+        rebind();
+      }
+      return *this;
+    }
+
+    SecondaryHeaderSlot &operator=(SecondaryHeaderSlot &&other) noexcept {
+      if (this != &other) {
+        m_inline = std::move(other.m_inline);
+        m_owned = std::move(other.m_owned);
+        rebind();
+        other.rebind();
+      }
+      return *this;
+    }
+
+    /** @brief Stores a copy of a fixed size PUS header inline. */
+    template <typename T>
+    void emplace(const T &header) {
+      m_inline.template emplace<T>(header);
+      m_owned.reset();
+      rebind();
+    }
+
+    /** @brief Holds a header owned through a shared pointer, replacing any inline header. */
+    void reset(std::shared_ptr<SecondaryHeaderAbstract> header) {
+      m_inline.template emplace<std::monostate>();
+      m_owned = std::move(header);
+      rebind();
+    }
+
+    /**
+     * @brief Returns an owning pointer to the header, moving an inline header to shared storage first.
+     *
+     * The data field and the caller then share the header, as for headers set through a shared pointer.
+     */
+    [[nodiscard]] std::shared_ptr<SecondaryHeaderAbstract> share() {
+      if (const auto *header = std::get_if<PusA>(&m_inline)) {
+        reset(std::make_shared<PusA>(*header));
+      } else if (const auto *headerB = std::get_if<PusB>(&m_inline)) {
+        reset(std::make_shared<PusB>(*headerB));
+      }
+      return m_owned;
+    }
+
+    [[nodiscard]] bool isInline() const { return m_inline.index() != 0; }
+
+    SecondaryHeaderAbstract *operator->() const { return m_header; }
+    SecondaryHeaderAbstract &operator*() const { return *m_header; }
+    explicit operator bool() const { return m_header != nullptr; }
+
+  private:
+    /** @brief Points the header at the inline storage if it holds a header, at the shared one otherwise. */
+    void rebind() {
+      if (auto *header = std::get_if<PusA>(&m_inline)) {
+        m_header = header;
+      } else if (auto *headerB = std::get_if<PusB>(&m_inline)) {
+        m_header = headerB;
+      } else {
+        m_header = m_owned.get();
+      }
+    }
+
+    std::variant<std::monostate, PusA, PusB> m_inline{};      ///< Inline storage for fixed size PUS headers
+    std::shared_ptr<SecondaryHeaderAbstract> m_owned{};       ///< Header owned through a shared pointer, if not inline
+    SecondaryHeaderAbstract *m_header{nullptr};               ///< The header, inline or shared
+  };
+
   /**
    * @brief Represents the data field of a CCSDS packet.
    *
@@ -27,31 +122,27 @@ namespace CCSDS {
    */
   class DataField {
   public:
-    DataField() {
-      bool noError = true;
-      ASSIGN_OR_PRINT(noError, m_secondaryHeaderFactory.registerType(std::make_shared<BufferHeader>()));
-      ASSIGN_OR_PRINT(noError, m_secondaryHeaderFactory.registerType(std::make_shared<PusA>()));
-      ASSIGN_OR_PRINT(noError, m_secondaryHeaderFactory.registerType(std::make_shared<PusB>()));
-      ASSIGN_OR_PRINT(noError, m_secondaryHeaderFactory.registerType(std::make_shared<PusC>()));
-      if (!noError) {
-        printf("[CCSDS DataField] Unable to Create Data field, secondary header registration failed.");
-      }
-    };
+    DataField() = default;
 
     ~DataField() = default;
+    DataField(const DataField &) = default;
+    DataField(DataField &&) noexcept = default;               ///< declared, the destructor would otherwise suppress it
+    DataField &operator=(const DataField &) = default;
+    DataField &operator=(DataField &&) noexcept = default;
 
     /**
     * @brief Registers a new header type with its creation function.
     *
-    * This function adds a new header type to the factory by associating the header's type string with a shared pointer to the header.
+    * This function adds a new header type to the process wide factory, the type is assigned the next free
+    * SecondaryHeaderTypeId and becomes available to every data field. Registering a type name again succeeds
+    * only if its size and length mode match the first registration.
     *
-    * @param header A shared pointer to a `SecondaryHeaderAbstract` object to register.
-     * @return ResultBool.
+     * @return ResultBool, error if the type name is already registered with a different layout.
     */
     template <typename T>
-    ResultBool RegisterSecondaryHeader() {
+    static ResultBool RegisterSecondaryHeader() {
 
-      FORWARD_RESULT(  m_secondaryHeaderFactory.registerType(std::make_shared<T>()));
+      FORWARD_RESULT(  SecondaryHeaderFactory::instance().registerType<T>());
 
       return true;
     }
@@ -83,6 +174,32 @@ namespace CCSDS {
      */
     [[nodiscard]] ResultBool setApplicationData(const std::uint8_t *pData, const size_t &sizeData);
 
+    /**
+     * @brief Appends bytes to the application data.
+     *
+     * @param pData A pointer to the bytes to append.
+     * @param sizeData The number of bytes to append.
+     * @return ResultBool, error if the data exceeds the available size.
+     */
+    [[nodiscard]] ResultBool appendApplicationData(const std::uint8_t *pData, const size_t &sizeData);
+
+    /**
+     * @brief Overwrites a byte range of the application data in place.
+     *
+     * @param offset position of the first byte to overwrite.
+     * @param pData A pointer to the new bytes.
+     * @param sizeData The number of bytes to overwrite.
+     * @return ResultBool, error if the range exceeds the application data.
+     */
+    [[nodiscard]] ResultBool patchApplicationData(const size_t &offset, const std::uint8_t *pData, const size_t &sizeData);
+
+    /**
+     * @brief Returns the data field to its default constructed state, keeping the application data capacity.
+     *
+     * The secondary header is released and the sizes and flags are reset, the registered header types are kept.
+     */
+    void clear();
+
     /**
      * @brief Sets the secondary header data for the data field.
      *
@@ -116,6 +233,20 @@ namespace CCSDS {
     [[nodiscard]] ResultBool setDataFieldHeader(const std::uint8_t *pData, const size_t &sizeData,
                                                 const std::string &pType);
 
+    /**
+     * @brief Sets the secondary header for the data field using a registered type identifier.
+     *
+     * The header is deserialized in place from the given bytes, PUS-A and PUS-B headers are stored inline in the
+     * data field, other types are created by the secondary header factory. On error the current header is kept.
+     *
+     * @param pData A pointer to the header data.
+     * @param sizeData The size of the header data in bytes.
+     * @param typeId The registered type, see SecondaryHeaderFactory::getTypeId().
+     * @return ResultBool.
+     */
+    [[nodiscard]] ResultBool setDataFieldHeader(const std::uint8_t *pData, const size_t &sizeData,
+                                                SecondaryHeaderTypeId typeId);
+
     /**
      * @brief Sets the data field header for the CCSDS DataField with a specific PUS type.
      *
@@ -170,11 +301,18 @@ namespace CCSDS {
     void setDataFieldHeader(std::shared_ptr<SecondaryHeaderAbstract> header);
 
     /**
-     * @brief returns the secondary header factory
+     * @brief Replaces a secondary header shared with other data fields, e.g. template copies, by an own copy.
+     *
+     * @return false if the header does not support clone(), it then stays shared.
+     */
+    bool detachSecondaryHeader();
+
+    /**
+     * @brief returns the secondary header factory, shared by every data field
      *
      * @return SecondaryHeaderFactory& .
      */
-    SecondaryHeaderFactory& getDataFieldHeaderFactory() {return m_secondaryHeaderFactory;}
+    static SecondaryHeaderFactory& getDataFieldHeaderFactory() {return SecondaryHeaderFactory::instance();}
 
     /**
      * @brief returns the secondary header
@@ -246,6 +384,17 @@ namespace CCSDS {
      */
     std::vector<std::uint8_t> getDataFieldHeaderBytes();
 
+    /** @brief returns the size of the secondary header in bytes, 0 if not set. */
+    [[nodiscard]] std::uint16_t getDataFieldHeaderBytesSize() const;
+
+    /**
+     * @brief Writes the updated secondary header in place.
+     *
+     * @param pData destination, must hold at least getDataFieldHeaderBytesSize() bytes.
+     * @return The number of bytes written, 0 if no secondary header is set.
+     */
+    std::uint16_t serializeDataFieldHeaderInto(std::uint8_t *pData);
+
     /**
      * @brief Retrieves the full data field by combining the data field header and application data.
      *
@@ -256,6 +405,14 @@ namespace CCSDS {
      */
     std::vector<std::uint8_t> serialize();
 
+    /**
+     * @brief Writes the full data field in place, secondary header (if present) followed by application data.
+     *
+     * @param pData destination, must hold at least getDataFieldUsedBytesSize() bytes.
+     * @return The number of bytes written.
+     */
+    std::size_t serializeInto(std::uint8_t *pData);
+
     /**
      * @brief Retrieves the application data from the data field.
      *
@@ -265,6 +422,9 @@ namespace CCSDS {
      */
     std::vector<std::uint8_t> getApplicationData();
 
+    /** @brief returns a reference to the application data, without copying it. */
+    [[nodiscard]] const std::vector<std::uint8_t> &getApplicationDataReference() const { return m_applicationData; }
+
     /** @brief returns true if auto update has been enabled for the secondary header */
     [[nodiscard]] bool getDataFieldHeaderAutoUpdateStatus() const { return m_enableDataFieldUpdate; }
 
@@ -274,12 +434,15 @@ namespace CCSDS {
      * @return boolean
      */
     [[nodiscard]] bool getDataFieldHeaderFlag() const {
-      return  m_secondaryHeader != nullptr;
+      return  static_cast<bool>(m_secondaryHeader);
     }
 
     /**
      * @brief retrieves the known PUS type
      *
+     * An inline PUS-A/B header is moved to shared storage on the first call, the returned pointer owns the header
+     * and stays valid after the data field is changed or destroyed. Use getDataFieldHeader() for plain access.
+     *
      * @return std::shared_ptr<SecondaryHeaderAbstract>
      */
     [[nodiscard]] std::shared_ptr<SecondaryHeaderAbstract> getSecondaryHeader();
@@ -295,10 +458,10 @@ namespace CCSDS {
     void update();
 
   private:
-    std::shared_ptr<SecondaryHeaderAbstract> m_secondaryHeader{};  ///< Shared pointer to the secondary header class
-    SecondaryHeaderFactory m_secondaryHeaderFactory;               ///< secondary header dispatcher factory
+    SecondaryHeaderSlot m_secondaryHeader{};                       ///< Secondary header, PUS-A/B stored inline
     std::vector<std::uint8_t> m_applicationData{};                      ///< Application data buffer
     std::string m_dataFieldHeaderType{};                           ///< Data field Header type
+    SecondaryHeaderTypeId m_dataFieldHeaderTypeId{INVALID_TYPE_ID}; ///< Data field Header type id, resolved when set
     std::uint16_t m_dataPacketSize{2024};                               ///< Data field maximum size in bytes
     bool m_dataFieldHeaderUpdated{false};                          ///< Boolean for secondary header updated status
     bool m_enableDataFieldUpdate{true};                            ///< Boolean for secondary header update enable
@@ -0,0 +1,211 @@
+// Copyright 2025-2026 ExoSpaceLabs
+// SPDX-License-Identifier: Apache-2.0
+
+#ifndef CCSDS_DEMULTIPLEXER_H
+#define CCSDS_DEMULTIPLEXER_H
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <vector>
+#include "CCSDSPacket.h"
+#include "CCSDSReassembler.h"
+#include "CCSDSResult.h"
+#include "CCSDSStreamDecoder.h"
+#include "CCSDSValidator.h"
+
+namespace CCSDS {
+
+  /**
+   * @brief Counters kept for every channel of a Demultiplexer.
+   */
+  struct DemuxChannelStatistics {
+    std::uint64_t packets{0};          ///< packets routed to the channel.
+    std::uint64_t invalidPackets{0};   ///< packets dropped as they failed validation.
+    ReassemblyStatistics reassembly{}; ///< units delivered to the sink and segments dropped.
+  };
+
+  /**
+   * @class Demultiplexer
+   * @brief Routes a multiplexed packet stream to per APID channels in a single pass.
+   *
+   * Each channel owns its template, validator state and sink, its segments are rebuilt by the Reassembler
+   * keyed by the same APID. Packets are located with a StreamDecoder, their APID selects the channel through
+   * a direct lookup table, so the cost per packet does not depend on the number of channels.
+   *
+   * Unsegmented packets are delivered to the sink as they are read, segmented sequences once their last
+   * segment arrives, see Reassembler for the handling of missing, duplicated and stale segments. The
+   * reassembler clock is the number of packets routed, so its timeout is expressed in packets. Packets
+   * failing validation are dropped, counted and reset the channel reassembly, the stream itself keeps
+   * being decoded.
+   *
+   * Typical usage:
+   * @code
+   * CCSDS::Demultiplexer demux;
+   * demux.addChannel(housekeepingTemplate, [&](std::uint16_t apid, const std::uint8_t *pData, std::size_t size) {
+   *   housekeeping.insert(housekeeping.end(), pData, pData + size);
+   * });
+   * demux.decode(buffer.data(), buffer.size());
+   * @endcode
+   */
+  class Demultiplexer {
+  public:
+    /**
+     * @brief Receives the application data of a complete unit, valid only for the duration of the call.
+     */
+    using Sink = std::function<void(std::uint16_t apid, const std::uint8_t *pData, std::size_t sizeData)>;
+
+    Demultiplexer();
+    Demultiplexer(const Demultiplexer &) = delete;            ///< the reassembler sink refers to this instance.
+    Demultiplexer &operator=(const Demultiplexer &) = delete;
+
+    /**
+     * @brief Adds a channel for the APID of a template packet.
+     *
+     * Packets are validated against the template when validation is enabled and the secondary header of
+     * the template is stripped from the delivered application data.
+     *
+     * @param templatePacket template of the channel packets.
+     * @param sink destination of the channel application data.
+     * @return ResultBool, error if the APID already has a channel.
+     */
+    [[nodiscard]] ResultBool addChannel(const Packet &templatePacket, Sink sink);
+
+    /**
+     * @brief Adds a channel for an APID without template, packets are only checked for coherence.
+     *
+     * @param apid 11 bits application process identifier.
+     * @param sink destination of the channel application data.
+     * @param secondaryHeaderSize bytes of the data field stripped as secondary header (default 0).
+     * @return ResultBool, error if the APID is invalid or already has a channel.
+     */
+    [[nodiscard]] ResultBool addChannel(std::uint16_t apid, Sink sink, std::uint16_t secondaryHeaderSize = 0);
+
+    /**
+     * @brief Sets the sink used for APIDs without channel, a channel is then created on their first packet.
+     *
+     * Without default sink packets of unknown APIDs are counted and dropped, see getUnroutedPackets().
+     *
+     * @param sink destination of the application data of unknown APIDs.
+     */
+    void setDefaultSink(Sink sink) { m_defaultSink = std::move(sink); }
+
+    /**
+     * enable validation of the routed packets, length and CRC coherence for every channel and
+     * template comparison for channels created from a template.
+     *
+     * @param enable bool (default true)
+     */
+    void setValidateEnable(const bool enable) { m_validateEnable = enable; }
+
+    /** @brief returns the current settings of the validation enable */
+    [[nodiscard]] bool getValidateEnable() const { return m_validateEnable; }
+
+    /**
+     * set sync pattern expected before each CCSDS packet.
+     *
+     * @param syncPattern std::uint32_t (default 0x1ACFFC1D)
+     */
+    void setSyncPattern(const std::uint32_t syncPattern) { m_decoder.setSyncPattern(syncPattern); }
+
+    /**
+     * enable sync pattern checking in front of each packet.
+     *
+     * @param enable bool (default false)
+     */
+    void setSyncPatternEnable(const bool enable) { m_decoder.setSyncPatternEnable(enable); }
+
+    /**
+     * enable resynchronisation on sync pattern mismatch.
+     *
+     * @param enable bool (default false)
+     */
+    void setResyncEnable(const bool enable) { m_decoder.setResyncEnable(enable); }
+
+    /**
+     * @brief Routes every complete packet of a chunk, packets split across chunks are completed by the next push.
+     *
+     * @param pData pointer to the chunk.
+     * @param sizeData size of the chunk in bytes.
+     * @return ResultBool, error on sync pattern mismatch without resynchronisation.
+     */
+    [[nodiscard]] ResultBool push(const std::uint8_t *pData, std::size_t sizeData);
+
+    /**
+     * @brief Routes every packet of a complete buffer, see push() and finish().
+     *
+     * @param pData pointer to the buffer holding packet data.
+     * @param sizeData size of the buffer in bytes.
+     * @return ResultBool, error on sync pattern mismatch or if the buffer ends inside a packet.
+     */
+    [[nodiscard]] ResultBool decode(const std::uint8_t *pData, std::size_t sizeData);
+
+    /**
+     * @brief Ends the stream, incomplete segmented sequences are discarded and counted.
+     *
+     * @return ResultBool, error if the stream ends inside a packet.
+     */
+    [[nodiscard]] ResultBool finish();
+
+    /** @brief returns true if the APID has a channel. */
+    [[nodiscard]] bool hasChannel(const std::uint16_t apid) const {
+      return apid < kApidCount && m_channelIndex[apid] != kNoChannel;
+    }
+
+    /** @brief returns the APIDs with a channel, in creation order. */
+    [[nodiscard]] std::vector<std::uint16_t> getChannels() const;
+
+    /**
+     * @brief returns the counters of a channel.
+     *
+     * @param apid 11 bits application process identifier.
+     * @return Result holding the statistics, error if the APID has no channel.
+     */
+    [[nodiscard]] Result<DemuxChannelStatistics> getChannelStatistics(std::uint16_t apid) const;
+
+    /** @brief returns the reassembler, to configure its memory limits and timeout. */
+    Reassembler &getReassembler() { return m_reassembler; }
+
+    /** @brief returns the number of packets dropped as their APID had no channel. */
+    [[nodiscard]] std::uint64_t getUnroutedPackets() const { return m_unroutedPackets; }
+
+    /** @brief returns the number of corrupt regions skipped while resynchronising. */
+    [[nodiscard]] std::uint64_t getSkippedRegions() const { return m_decoder.getSkippedRegions(); }
+
+    /** @brief returns the number of bytes skipped while resynchronising. */
+    [[nodiscard]] std::uint64_t getSkippedBytes() const { return m_decoder.getSkippedBytes(); }
+
+  private:
+    static constexpr std::size_t kApidCount = 2048;
+    static constexpr std::uint16_t kNoChannel = 0xFFFF;
+
+    /** @brief state of a single APID. */
+    struct Channel {
+      std::uint16_t apid{0};
+      std::uint16_t secondaryHeaderSize{0}; ///< data field bytes stripped before delivery.
+      Validator validator{};
+      Sink sink{};
+      DemuxChannelStatistics statistics{};
+    };
+
+    /** @brief creates the channel and registers it in the lookup table. */
+    ResultBool createChannel(std::uint16_t apid, Sink sink, std::uint16_t secondaryHeaderSize,
+                             const Packet *templatePacket);
+
+    /** @brief validates and routes a single packet to its channel. */
+    ResultBool route(const PacketView &view);
+
+    StreamDecoder m_decoder{};
+    Reassembler m_reassembler{};
+    std::array<std::uint16_t, kApidCount> m_channelIndex{}; ///< APID to channel position, kNoChannel if none.
+    std::vector<Channel> m_channels{};
+    Sink m_defaultSink{};
+    bool m_validateEnable{true};
+    std::uint64_t m_unroutedPackets{0};
+    std::uint64_t m_routedPackets{0};   ///< clock of the reassembler.
+  };
+
+} // namespace CCSDS
+
+#endif // CCSDS_DEMULTIPLEXER_H
@@ -5,6 +5,8 @@
 #define CCSDS_HEADER_H
 
 #include <CCSDSResult.h>
+#include <array>
+#include <cstddef>
 #include <cstdint>
 #include <vector>
 
@@ -55,6 +57,8 @@ namespace CCSDS {
     // data packet length
     std::uint16_t dataLength{};                ///< 16 bits
 
+    constexpr PrimaryHeader() = default;
+
     /**
      * @brief Constructs a PrimaryHeader with specified field values.
      *
@@ -66,7 +70,7 @@ namespace CCSDS {
      * @param sequenceCount_value 14-bit sequence count.
      * @param dataLength_value 16-bit data length.
      */
-    PrimaryHeader(const std::uint8_t versionNumber_value, const std::uint8_t type_value, const std::uint8_t dataFieldHeaderFlag_value,
+    constexpr PrimaryHeader(const std::uint8_t versionNumber_value, const std::uint8_t type_value, const std::uint8_t dataFieldHeaderFlag_value,
                   const std::uint16_t APID_value, const std::uint8_t sequenceFlag_value, const std::uint16_t sequenceCount_value,
                   const std::uint16_t dataLength_value) : versionNumber(versionNumber_value), type(type_value),
                                                      dataFieldHeaderFlag(dataFieldHeaderFlag_value),
@@ -76,6 +80,75 @@ namespace CCSDS {
     }
   };
 
+  /** @brief size of the serialized primary header in bytes. */
+  constexpr std::size_t kPrimaryHeaderSize = 6;
+
+  /** @brief serialized primary header, big endian as transmitted. */
+  using PrimaryHeaderBytes = std::array<std::uint8_t, kPrimaryHeaderSize>;
+
+  /**
+   * @brief Writes the 6 bytes of a primary header, fields wider than their bit size are masked.
+   *
+   * @param header primary header fields.
+   * @param pData destination of at least 6 bytes.
+   */
+  constexpr void encodePrimaryHeader(const PrimaryHeader &header, std::uint8_t *pData) {
+    const auto identification = static_cast<std::uint16_t>((header.versionNumber & 0x7) << 13 | (header.type & 0x1) << 12 |
+                                                           (header.dataFieldHeaderFlag & 0x1) << 11 | (header.APID & 0x07FF));
+    const auto sequenceControl = static_cast<std::uint16_t>((header.sequenceFlags & 0x3) << 14 | (header.sequenceCount & 0x3FFF));
+    pData[0] = static_cast<std::uint8_t>(identification >> 8);
+    pData[1] = static_cast<std::uint8_t>(identification & 0xFF);
+    pData[2] = static_cast<std::uint8_t>(sequenceControl >> 8);
+    pData[3] = static_cast<std::uint8_t>(sequenceControl & 0xFF);
+    pData[4] = static_cast<std::uint8_t>(header.dataLength >> 8);
+    pData[5] = static_cast<std::uint8_t>(header.dataLength & 0xFF);
+  }
+
+  /** @brief Returns the 6 bytes of a primary header, see the pointer overload. */
+  constexpr PrimaryHeaderBytes encodePrimaryHeader(const PrimaryHeader &header) {
+    PrimaryHeaderBytes data{};
+    encodePrimaryHeader(header, data.data());
+    return data;
+  }
+
+  /**
+   * @brief Reads the fields of a primary header.
+   *
+   * @param pData first of the 6 bytes of the primary header.
+   * @return PrimaryHeader
+   */
+  constexpr PrimaryHeader decodePrimaryHeader(const std::uint8_t *pData) {
+    return PrimaryHeader{static_cast<std::uint8_t>(pData[0] >> 5),
+                         static_cast<std::uint8_t>((pData[0] >> 4) & 0x1),
+                         static_cast<std::uint8_t>((pData[0] >> 3) & 0x1),
+                         static_cast<std::uint16_t>((pData[0] & 0x07) << 8 | pData[1]),
+                         static_cast<std::uint8_t>(pData[2] >> 6),
+                         static_cast<std::uint16_t>((pData[2] & 0x3F) << 8 | pData[3]),
+                         static_cast<std::uint16_t>(pData[4] << 8 | pData[5])};
+  }
+
+  /** @brief Reads the fields of a primary header, see the pointer overload. */
+  constexpr PrimaryHeader decodePrimaryHeader(const PrimaryHeaderBytes &data) {
+    return decodePrimaryHeader(data.data());
+  }
+
+  /**
+   * @brief Decodes the primary headers of a batch of packets into columns of 16 bit words.
+   *
+   * Each header yields its packet identification word (version, type, secondary header flag and APID), its
+   * sequence control word (flags and count) and its data length, in host byte order. Eight headers are
+   * transposed and byte swapped per iteration with SSE2 or NEON shuffles, the rest with the scalar codec.
+   *
+   * @param pData buffer holding the packets.
+   * @param offsets byte offset of each packet in the buffer, every packet being at least 8 bytes long.
+   * @param count number of packets.
+   * @param identification destination of count packet identification words.
+   * @param sequenceControl destination of count sequence control words.
+   * @param dataLength destination of count data lengths.
+   */
+  void decodePrimaryHeaders(const std::uint8_t *pData, const std::uint64_t *offsets, std::size_t count,
+                            std::uint16_t *identification, std::uint16_t *sequenceControl, std::uint16_t *dataLength);
+
   /**
    * @class Header
    * @brief Manages the decomposition and manipulation of CCSDS primary headers.
@@ -100,6 +173,18 @@ namespace CCSDS {
      */
     std::vector<std::uint8_t> serialize();
 
+    /**
+     * @brief writes the 6 bytes of the primary header without allocating.
+     *
+     * @param pData destination of at least 6 bytes.
+     */
+    void serializeInto(std::uint8_t *pData) const { encodePrimaryHeader(getData(), pData); }
+
+    /** @brief returns the header fields. */
+    [[nodiscard]] PrimaryHeader getData() const {
+      return {m_versionNumber, m_type, m_dataFieldHeaderFlag, m_APID, m_sequenceFlags, m_sequenceCount, m_dataLength};
+    }
+
     /**
      * @brief Computes and retrieves the full header as a 64-bit value. Combines individual header fields into a
      * single 64-bit representation.
@@ -150,6 +235,15 @@ namespace CCSDS {
      */
     [[nodiscard]] ResultBool deserialize(const std::vector<std::uint8_t> &data);
 
+    /**
+     * @brief Sets the header data from the 6 bytes of a serialized primary header.
+     *
+     * @param pData pointer to the primary header.
+     * @param sizeData number of readable bytes, at least 6.
+     * @return ResultBool.
+     */
+    [[nodiscard]] ResultBool deserialize(const std::uint8_t *pData, std::size_t sizeData);
+
 
     /**
      * @brief Sets the header data from a `PrimaryHeader` structure.
@@ -6,7 +6,9 @@
 
 #include <utility>
 #include "CCSDSPacket.h"
+#include "CCSDSPacketIndex.h"
 #include "CCSDSResult.h"
+#include "CCSDSStreamDecoder.h"
 #include "CCSDSValidator.h"
 
 namespace CCSDS {
@@ -67,6 +69,35 @@ namespace CCSDS {
      */
     bool getSyncPatternEnable() const;
 
+    /**
+     * enable resynchronisation when loading, on sync pattern mismatch the loader skips to the next
+     * sync pattern instead of failing. requires the sync pattern to be enabled.
+     *
+     * @param enable bool (default false)
+     */
+    void setResyncEnable(bool enable);
+
+    /**
+     * returns the current settings of the resynchronisation enable
+     *
+     * @return bool
+     */
+    bool getResyncEnable() const;
+
+    /**
+     * returns the number of corrupt regions skipped by the last load, read or getPacketViews call.
+     *
+     * @return std::uint64_t
+     */
+    std::uint64_t getSkippedRegions() const;
+
+    /**
+     * returns the number of bytes skipped by the last load, read or getPacketViews call.
+     *
+     * @return std::uint64_t
+     */
+    std::uint64_t getSkippedBytes() const;
+
     /**
      * @brief Sets a new packet template.
      *
@@ -75,14 +106,15 @@ namespace CCSDS {
     [[nodiscard]] ResultBool setPacketTemplate(Packet packet);
 
     /**
-    * @brief Loads a template packet from a configuration file.
+    * @brief Loads a template packet from a configuration file, packets are validated against it as with
+    * setPacketTemplate().
     *
     * @param configPath  path to the configuration file.
     */
     [[nodiscard]] ResultBool loadTemplateConfigFile(const std::string &configPath);
 #ifndef CCSDS_MCU
     /**
-    * @brief Loads a template packet from a configuration object.
+    * @brief Loads a template packet from a configuration object, see loadTemplateConfigFile().
     *
     * @param cfg  Configuration obj to load template from.
     */
@@ -106,11 +138,55 @@ namespace CCSDS {
     /**
      * @brief Sets the application data for the packet.
      *
+     * The data is segmented into template based packets. Sequence flags and counts are planned up front,
+     * so with more than one thread set the packets are built, updated and checksummed concurrently, the
+     * result being identical to the serial path.
+     *
      * @param data The application data as a vector of bytes.
      * @return ResultBool indicating success or failure.
      */
     ResultBool setApplicationData( const std::vector<std::uint8_t> &data );
 
+    /**
+     * set the number of threads used by setApplicationData to build segmented packets. the serial path
+     * is used for a single thread, when building for MCU or if the template secondary header does not
+     * support clone().
+     *
+     * @param count std::uint32_t (default 1), 0 selects the number of hardware threads.
+     */
+    void setThreadCount(std::uint32_t count);
+
+    /**
+     * returns the configured number of threads.
+     *
+     * @return std::uint32_t
+     */
+    std::uint32_t getThreadCount() const;
+
+    /**
+     * set the maximum number of packets kept for reuse when the stored packets are cleared. recycled packets
+     * keep their application data buffers, load and setApplicationData build into them instead of allocating,
+     * so repeated clearPackets() / load() cycles of similar captures reach a steady state without packet or
+     * payload allocations.
+     *
+     * @param maxPackets std::size_t (default 0), 0 disables recycling and releases the pooled packets.
+     */
+    void setPacketPoolSize(std::size_t maxPackets);
+
+    /**
+     * returns the maximum number of packets kept for reuse.
+     *
+     * @return std::size_t
+     */
+    std::size_t getPacketPoolSize() const;
+
+    /**
+     * returns the number of packets currently held for reuse.
+     *
+     * @return std::size_t
+     */
+    std::size_t getPooledPackets() const;
+
     /**
      * @brief Enables or disables automatic updates for packets.
      *
@@ -144,9 +220,18 @@ namespace CCSDS {
     /**
      * @brief Retrieves a buffer containing all the stored packets sequentially.
      *
+     * Packets pending an update are updated in place before being written, so the call is not const.
+     *
      * @return A vector of bytes containing the packets data.
      */
-    std::vector<std::uint8_t> getPacketsBuffer() const;
+    std::vector<std::uint8_t> getPacketsBuffer();
+
+    /**
+     * @brief Computes the exact size of the buffer returned by getPacketsBuffer(), sync patterns included.
+     *
+     * @return size in bytes.
+     */
+    [[nodiscard]] std::size_t getPacketsBufferSize() const;
 
     /**
      * @brief Retrieves the application data from the packets.
@@ -187,10 +272,32 @@ namespace CCSDS {
     /**
      * @brief Retrieves all stored packets.
      *
+     * @note returns a copy of every packet, use getPacketsReference() or forEachPacket() to iterate.
+     *
      * @return A vector containing all managed packets.
      */
     std::vector<Packet> getPackets();
 
+    /**
+     * @brief Calls the visitor with a reference to every stored packet, in order, without copying them.
+     *
+     * @param visitor callable taking (Packet&).
+     */
+    template <typename Visitor>
+    void forEachPacket(Visitor &&visitor) {
+      for (auto &packet : m_packets) {
+        visitor(packet);
+      }
+    }
+
+    /** @brief const overload of forEachPacket, the visitor takes (const Packet&). */
+    template <typename Visitor>
+    void forEachPacket(Visitor &&visitor) const {
+      for (const auto &packet : m_packets) {
+        visitor(packet);
+      }
+    }
+
     /**
      * @brief Adds a new packet to the list.
      *
@@ -205,6 +312,13 @@ namespace CCSDS {
      */
     [[nodiscard]] ResultBool addPacketFromBuffer(const std::vector<std::uint8_t>& packetBuffer);
 
+    /**
+     * @brief Adds a new packet to the list, materialized from a packet view.
+     *
+     * @param packetView view over the serialized packet to be added.
+     */
+    [[nodiscard]] ResultBool addPacketFromView(const PacketView& packetView);
+
     /**
      * @brief Load a vector of packets.
      *
@@ -219,6 +333,65 @@ namespace CCSDS {
      */
     [[nodiscard]] ResultBool load(const std::vector<std::uint8_t>& packetsBuffer);
 
+    /**
+     * @brief Load a packet or a series of packets from a raw buffer
+     *
+     * Packets are located in place using packet views, each packet's bytes are copied only once
+     * when it is materialized.
+     *
+     * @param pData pointer to the buffer holding packet data.
+     * @param sizeData size of the buffer in bytes.
+     */
+    [[nodiscard]] ResultBool load(const std::uint8_t *pData, size_t sizeData);
+
+    /**
+     * @brief Locates the packets held by a raw buffer without materializing them.
+     *
+     * Applies the same sync pattern and header length framing as load(). The views point into the
+     * given buffer, which must outlive them. With resynchronisation enabled corrupt regions, including
+     * a truncated tail, are skipped and counted instead of failing.
+     *
+     * @param pData pointer to the buffer holding packet data.
+     * @param sizeData size of the buffer in bytes.
+     * @param views vector the located packet views are appended to.
+     */
+    [[nodiscard]] ResultBool getPacketViews(const std::uint8_t *pData, size_t sizeData,
+                                            std::vector<PacketView> &views);
+
+    /**
+     * @brief Locates the packets held by a raw buffer and appends their primary headers to a packet index.
+     *
+     * Applies the same framing as getPacketViews(), no packet is materialized. Without sync pattern the
+     * packets are located by chaining their data lengths and the headers are decoded in batches, see
+     * decodePrimaryHeaders(). The index offsets are relative to pData.
+     *
+     * @param pData pointer to the buffer holding packet data.
+     * @param sizeData size of the buffer in bytes.
+     * @param index index the located packets are appended to.
+     */
+    [[nodiscard]] ResultBool indexPackets(const std::uint8_t *pData, size_t sizeData, PacketIndex &index);
+
+    /**
+     * enable building the packet index while loading. each packet added by load or read appends a row to
+     * the index, the offsets being relative to the buffer of that load. the rows match the stored packets
+     * as long as packets are only added by load or read.
+     *
+     * @param enable bool (default false)
+     */
+    void setPacketIndexEnable(bool enable);
+
+    /**
+     * returns the current settings of the packet index enable
+     *
+     * @return bool
+     */
+    bool getPacketIndexEnable() const;
+
+    /**
+     * @brief Returns the packet index built while loading, cleared with the packets.
+     */
+    [[nodiscard]] const PacketIndex &getPacketIndex() const { return m_packetIndex; }
+
     /**
      * @brief Load a packet or a series of packets from a binary file
      *
@@ -231,7 +404,7 @@ namespace CCSDS {
      *
      * @param binaryFile destination file path for packets data.
      */
-    [[nodiscard]] ResultBool write(const std::string& binaryFile) const;
+    [[nodiscard]] ResultBool write(const std::string& binaryFile);
 
     /**
      * @brief Load a template packet from a binary or configuration file
@@ -247,6 +420,8 @@ namespace CCSDS {
 
     /**
      * @brief Clears the packets and sets the counter to 0.
+     *
+     * With a packet pool set the packets are recycled rather than destroyed, see setPacketPoolSize().
      */
     void clearPackets();
 
@@ -264,17 +439,62 @@ namespace CCSDS {
      */
     std::vector<Packet>& getPacketsReference() { return m_packets; }
 
+    /**
+     * @brief Returns a read only reference to the packets vector, to be iterated as a range.
+     */
+    [[nodiscard]] const std::vector<Packet>& getPacketsReference() const { return m_packets; }
+
   private:
+    /** @brief returns a cleared packet from the pool, or a new packet if the pool is empty. */
+    Packet acquirePacket();
+
+    /**
+     * @brief moves the stored packets to the pool up to its size and clears them and the packet index, keeping the
+     * vector capacity.
+     */
+    void recyclePackets();
+
+    /** @brief slice of the application data carried by one packet, planned before the packets are built. */
+    struct Segment {
+      std::size_t offset{0};              ///< first application data byte of the packet.
+      std::uint16_t size{0};              ///< application data bytes of the packet.
+      ESequenceFlag sequenceFlag{UNSEGMENTED};
+      std::uint16_t sequenceCount{0};
+      bool setSequence{false};            ///< false for unsegmented packets, they keep the template sequence fields.
+    };
+
+    /** @brief splits sizeData bytes into segments, advancing the sequence count as the packets would. */
+    std::vector<Segment> planSegments(std::size_t sizeData, std::uint16_t maxBytesPerPacket);
+
+    /** @brief sets the data and sequence fields of a template copy for the given segment. */
+    ResultBool fillSegment(Packet &packet, const std::vector<std::uint8_t> &data, const Segment &segment) const;
+
+#ifndef CCSDS_MCU
+    /** @brief builds the packets of the planned segments spread over threadCount threads. */
+    ResultBool buildSegmentsParallel(const std::vector<std::uint8_t> &data, const std::vector<Segment> &segments,
+                                     std::uint32_t threadCount);
+#endif
+
     Packet m_templatePacket{};         ///< The template packet used for generating new packets.
     bool m_templateIsSet  { false };   ///< Boolean to indicate if Template has been set or not.
     bool m_updateEnable   {  true };   ///< bool indicating whether automatic updates are enabled (default: true).
     bool m_validateEnable {  true };   ///< bool indicating whether automatic validation is enabled (default: true).
     bool m_syncPattEnable { false };   ///< bool indicating whether automatic sync pattern insertion is enabled (default: false).
+    bool m_resyncEnable   { false };   ///< bool indicating whether loading skips to the next sync pattern on mismatch (default: false).
+    bool m_indexEnable    { false };   ///< bool indicating whether loading builds the packet index (default: false).
     std::vector<Packet> m_packets;     ///< Collection of stored packets.
+    std::vector<Packet> m_packetPool;  ///< cleared packets waiting to be reused.
+    std::size_t m_packetPoolSize{ 0 }; ///< maximum number of pooled packets, 0 disables recycling.
+    std::vector<PacketView> m_views;   ///< packet views located by load, reused across loads.
+    std::vector<std::uint64_t> m_offsets; ///< packet offsets located by indexPackets, reused across calls.
+    PacketIndex m_packetIndex{};       ///< primary header columns of the loaded packets.
     std::uint16_t m_sequenceCount{ 0 };
+    std::uint32_t m_threadCount{ 1 };  ///< threads building segmented packets, 0 for the hardware threads.
 
     Validator m_validator{};
     std::uint32_t m_syncPattern{0x1ACFFC1D};
+    std::uint64_t m_skippedRegions{0}; ///< corrupt regions skipped by the last load.
+    std::uint64_t m_skippedBytes{0};   ///< bytes skipped by the last load.
   };
 } // namespace CCSDS
 
@@ -0,0 +1,74 @@
+// Copyright 2025-2026 ExoSpaceLabs
+// SPDX-License-Identifier: Apache-2.0
+
+#ifndef CCSDS_MAPPED_FILE_H
+#define CCSDS_MAPPED_FILE_H
+
+#include <CCSDSResult.h>
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include "CCSDSPacketView.h"
+
+namespace CCSDS {
+
+  /**
+   * @class MappedFile
+   * @brief Read only memory mapping of a whole file.
+   *
+   * The file is mapped with mmap (CreateFileMapping on Windows) and advised for sequential
+   * access by default, so pages are read ahead by the kernel on demand and dropped under memory
+   * pressure instead of being copied into a heap buffer. The mapped bytes can be handed directly to
+   * Manager::load(), Manager::getPacketViews() or StreamDecoder::push().
+   *
+   * @note host only, not available when building for MCU.
+   */
+  class MappedFile {
+  public:
+    MappedFile() = default;
+    ~MappedFile();
+
+    MappedFile(const MappedFile &) = delete;
+    MappedFile &operator=(const MappedFile &) = delete;
+    MappedFile(MappedFile &&other) noexcept;
+    MappedFile &operator=(MappedFile &&other) noexcept;
+
+    /**
+     * @brief Maps the given file, unmapping any previously opened one.
+     *
+     * @param filename path of the file to map.
+     * @param sequential advise sequential access, false advises random access to avoid reading ahead (default true).
+     * @return ResultBool
+     */
+    [[nodiscard]] ResultBool open(const std::string &filename, bool sequential = true);
+
+    /** @brief unmaps the file, data() is nullptr afterwards. */
+    void close();
+
+    /** @brief returns the first mapped byte, nullptr if no file is open or the file is empty. */
+    [[nodiscard]] const std::uint8_t *data() const { return m_data; }
+
+    /** @brief returns the size of the mapped file in bytes. */
+    [[nodiscard]] std::size_t size() const { return m_size; }
+
+    /** @brief returns true if no bytes are mapped. */
+    [[nodiscard]] bool empty() const { return m_size == 0; }
+
+    /** @brief returns true if a file has been opened. */
+    [[nodiscard]] bool isOpen() const { return m_isOpen; }
+
+    /** @brief returns the mapped bytes as a view. */
+    [[nodiscard]] BufferView view() const { return {m_data, m_size}; }
+
+  private:
+    const std::uint8_t *m_data{nullptr}; ///< first mapped byte.
+    std::size_t m_size{0};               ///< mapped size in bytes.
+    bool m_isOpen{false};                ///< a file is currently opened.
+#ifdef _WIN32
+    void *m_fileHandle{nullptr};         ///< handle of the opened file.
+    void *m_mappingHandle{nullptr};      ///< handle of the file mapping object.
+#endif
+  };
+}
+
+#endif // CCSDS_MAPPED_FILE_H
@@ -4,20 +4,29 @@
 #ifndef CCSDSPACK_H
 #define CCSDSPACK_H
 
+#include "CCSDSCrc.h"
 #include "CCSDSDataField.h"
+#include "CCSDSDemultiplexer.h"
 #include "CCSDSHeader.h"
 #include "CCSDSManager.h"
 #include "CCSDSPacket.h"
+#include "CCSDSPacketIndex.h"
+#include "CCSDSPacketView.h"
+#include "CCSDSReassembler.h"
 #include "CCSDSResult.h"
 #include "CCSDSSecondaryHeaderAbstract.h"
 #include "CCSDSSecondaryHeaderFactory.h"
+#include "CCSDSStreamDecoder.h"
+#include "CCSDSStreamEncoder.h"
 #include "CCSDSUtils.h"
 #include "CCSDSValidator.h"
 #include "PusServices.h"
 
 //exclude includes when building for MCU
 #ifndef CCSDS_MCU
+  #include "CCSDSCaptureIndex.h"
   #include "CCSDSConfig.h"
+  #include "CCSDSMappedFile.h"
 #endif //CCSDS_MCU
 
 #endif //CCSDSPACK_H
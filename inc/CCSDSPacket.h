@@ -27,6 +27,8 @@
 #include <vector>
 #include "CCSDSHeader.h"
 #include "CCSDSDataField.h"
+#include "CCSDSCrc.h"
+#include "CCSDSPacketView.h"
 
 /**
  * @namespace CCSDS
@@ -34,14 +36,6 @@
  */
 namespace CCSDS {
 
-  /** Configuration structure for CRC16 calculation parameters */
-  struct CRC16Config {
-    std::uint16_t polynomial = 0x1021;
-    std::uint16_t initialValue = 0xFFFF;
-    std::uint16_t finalXorValue = 0x0000;
-  };
-
-
   /**
    * @brief Represents a CCSDS (Consultative Committee for Space Data Systems) packet.
    *
@@ -119,17 +113,27 @@ namespace CCSDS {
      */
     void setDataFieldHeader(const std::shared_ptr<SecondaryHeaderAbstract> &header);
 
+    /**
+     * @brief Gives the packet its own copy of a secondary header shared with other packets.
+     *
+     * Packet copies share the secondary header of the original, a packet must own its header to be
+     * updated concurrently with its copies.
+     *
+     * @return false if the secondary header does not support clone().
+     */
+    bool detachSecondaryHeader();
+
     /**
     * @brief Registers a new header type with the data field secondary header creation function.
     *
-    * This function adds a new header type to the factory by associating the header's type string with a shared pointer to the header.
+    * This function adds a new header type to the process wide factory shared by every packet, see
+    * SecondaryHeaderFactory::instance(), see DataField::RegisterSecondaryHeader().
     *
-    * @param header A shared pointer to a `SecondaryHeaderAbstract` object to register.
-     * @return ResultBool.
+     * @return ResultBool, error if the type name is already registered with a different layout.
     */
     template <typename T>
-    ResultBool RegisterSecondaryHeader() {
-      FORWARD_RESULT( m_dataField.RegisterSecondaryHeader<T>());
+    static ResultBool RegisterSecondaryHeader() {
+      FORWARD_RESULT( DataField::RegisterSecondaryHeader<T>());
       return true;
     }
 
@@ -218,6 +222,38 @@ namespace CCSDS {
      */
     [[nodiscard]] ResultBool setApplicationData(const std::uint8_t *pData, size_t sizeData);
 
+    /**
+     * @brief Appends bytes to the application data of the packet.
+     *
+     * The CRC of the application data already present is kept, update() only processes the appended bytes
+     * and the secondary header.
+     *
+     * @param pData A pointer to the bytes to append.
+     * @param sizeData The number of bytes to append.
+     * @return ResultBool.
+     */
+    [[nodiscard]] ResultBool appendApplicationData(const std::uint8_t *pData, size_t sizeData);
+
+    /**
+     * @brief Overwrites a byte range of the application data in place.
+     *
+     * The CRC is patched for the replaced range, the rest of the application data is not processed again.
+     *
+     * @param offset position of the first byte to overwrite.
+     * @param pData A pointer to the new bytes.
+     * @param sizeData The number of bytes to overwrite.
+     * @return ResultBool.
+     */
+    [[nodiscard]] ResultBool patchApplicationData(size_t offset, const std::uint8_t *pData, size_t sizeData);
+
+    /**
+     * @brief Returns the packet to its default constructed state without releasing its buffers.
+     *
+     * Used to recycle packets, deserializing into a cleared packet reuses the application data capacity
+     * instead of allocating it again.
+     */
+    void clear();
+
     /**
      * @brief Sets the sequence flags for the packet's primary header.
      *
@@ -255,12 +291,28 @@ namespace CCSDS {
     /** @brief Deserializes a CCSDS packet using a vector and a registered header type. */
     [[nodiscard]] ResultBool deserialize(const std::vector<std::uint8_t> &data, const std::string& headerType, std::int32_t headerSize = -1);
 
+    /**
+     * @brief Deserializes a CCSDS packet using a vector and a registered header type identifier.
+     *
+     * The secondary header is a new instance created by the data field factory, headerSize is used for
+     * variable length headers only.
+     */
+    [[nodiscard]] ResultBool deserialize(const std::vector<std::uint8_t> &data, SecondaryHeaderTypeId typeId, std::int32_t headerSize = -1);
+
     /** @brief Deserializes a CCSDS packet using a vector and a header data size. */
     [[nodiscard]] ResultBool deserialize(const std::vector<uint8_t> &data, std::uint16_t headerDataSizeBytes);
 
     /** @brief Deserializes a CCSDS packet using separate header and data vectors. */
     [[nodiscard]] ResultBool deserialize(const std::vector<uint8_t> &headerData, const std::vector<uint8_t> &data);
 
+    /**
+     * @brief Materializes a packet from a packet view.
+     *
+     * The viewed bytes are copied once into the packet, the secondary header (if the view defines one)
+     * is stored as a BufferHeader.
+     */
+    [[nodiscard]] ResultBool deserialize(const PacketView &view);
+
     /**
      * @brief Retrieves the primary header of the packet.
      *
@@ -274,9 +326,9 @@ namespace CCSDS {
 
     /** @brief Retrieves the current size of the CCSDS Packet
      *
-     * @return 16bit unsigned integer
+     * @return size in bytes, up to 65543 for a full data field.
      */
-    std::uint16_t getFullPacketLength();
+    std::size_t getFullPacketLength() const;
 
     /**
      * @brief Retrieves the full packet as a vector of bytes.
@@ -291,6 +343,26 @@ namespace CCSDS {
      */
     std::vector<uint8_t> serialize();
 
+    /**
+     * @brief Writes the full packet into a caller provided buffer in a single pass.
+     *
+     * Primary header, secondary header, application data and CRC-16 are written in place, without
+     * intermediate vectors.
+     *
+     * @param pData destination buffer.
+     * @param capacity size of the destination buffer, must be at least getFullPacketLength().
+     * @return The number of bytes written or Error.
+     */
+    [[nodiscard]] Result<std::size_t> serializeInto(std::uint8_t *pData, std::size_t capacity);
+
+    /**
+     * @brief Appends the full packet to the given vector, growing it once by the packet size.
+     *
+     * @param buffer destination vector.
+     * @return The number of bytes appended or Error.
+     */
+    [[nodiscard]] Result<std::size_t> serializeInto(std::vector<std::uint8_t> &buffer);
+
     /**
      * @brief Retrieves the primary header of the packet as a vector of bytes.
      *
@@ -367,7 +439,7 @@ namespace CCSDS {
      *
      * @param crcConfig
      */
-    void setCrcConfig(const CRC16Config crcConfig) {m_CRC16Config = crcConfig;}
+    void setCrcConfig(const CRC16Config crcConfig) {m_CRC16Config = crcConfig; m_dirty = kDirtyAll;}
 
 
     /**
@@ -383,12 +455,16 @@ namespace CCSDS {
      * @param initialValue
      * @param finalXorValue
      */
-    void setCrcConfig(const std::uint16_t polynomial, const std::uint16_t initialValue, const std::uint16_t finalXorValue) {m_CRC16Config = {polynomial, initialValue, finalXorValue};}
+    void setCrcConfig(const std::uint16_t polynomial, const std::uint16_t initialValue, const std::uint16_t finalXorValue) {m_CRC16Config = {polynomial, initialValue, finalXorValue}; m_dirty = kDirtyAll;}
 
     /**
      * @brief Updates Primary headers data field size.
      *
-     * Uses the currently set data field size to set the header.
+     * Uses the currently set data field size to set the header. Only the parts invalidated by setters since the
+     * last update are recomputed: sequence and primary header changes refresh the header fields, data field and
+     * CRC configuration changes also recompute the CRC. The CRC of the application data is kept separately and
+     * combined with the secondary header, so header changes, appends and patches only process the changed bytes.
+     * A clean packet returns immediately, so getters are O(1).
      *
      * @return none.
      */
@@ -413,11 +489,21 @@ namespace CCSDS {
 #endif
 
   private:
+    static constexpr std::uint8_t kClean = 0x0;               ///< nothing to recompute
+    static constexpr std::uint8_t kDirtyPrimaryHeader = 0x1;  ///< data length, header flag and sequence count
+    static constexpr std::uint8_t kDirtyCrc = 0x2;            ///< CRC over the data field, from the application data CRC
+    static constexpr std::uint8_t kDirtyApplicationCrc = 0x4; ///< CRC of the application data
+    static constexpr std::uint8_t kDirtyAll = kDirtyPrimaryHeader | kDirtyCrc | kDirtyApplicationCrc;
+
+    /** @brief writes the updated packet to pData, which holds at least getFullPacketLength() bytes. */
+    std::size_t writePacket(std::uint8_t *pData);
+
     Header m_primaryHeader{};        ///< 6 bytes / 48 bits / 12 hex
     DataField m_dataField{};         ///< variable
     std::uint16_t m_CRC16{};              ///< Cyclic Redundancy check 16 bits
+    CRC16State m_applicationDataCrc{{0x1021, 0x0000, 0x0000}}; ///< zero initialized CRC of the application data
     CRC16Config m_CRC16Config;       ///< structure holding configuration of crc calculation.
-    bool m_updateStatus{false};      ///< When setting data thus value should be set to false.
+    std::uint8_t m_dirty{kDirtyAll}; ///< Parts of the packet to recompute on update(), set by the setters.
     bool m_enableUpdatePacket{true}; ///< Enables primary header and secondary header update.
     std::uint16_t m_sequenceCounter{0};
   };
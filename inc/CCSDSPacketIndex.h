@@ -0,0 +1,139 @@
+// Copyright 2025-2026 ExoSpaceLabs
+// SPDX-License-Identifier: Apache-2.0
+
+#ifndef CCSDS_PACKET_INDEX_H
+#define CCSDS_PACKET_INDEX_H
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+#include "CCSDSPacketView.h"
+
+namespace CCSDS {
+
+  /**
+   * @class PacketIndex
+   * @brief Columnar index of the primary headers of a series of packets.
+   *
+   * Every located packet adds one row, stored as parallel arrays of the packet identification word
+   * (version, type, secondary header flag and APID), the sequence control word, the data length and the
+   * byte offset of the packet in its source buffer. Queries scan only the columns they need and never
+   * touch the packet payloads, the counting loops are simple enough for the compiler to vectorize.
+   *
+   * Typical usage:
+   * @code
+   * CCSDS::PacketIndex index;
+   * manager.indexPackets(buffer.data(), buffer.size(), index);
+   * for (const auto row : index.findSequenceGaps(0x123)) {
+   *   // index.getOffset(row) locates the packet following the gap in the buffer
+   * }
+   * @endcode
+   */
+  class PacketIndex {
+  public:
+    PacketIndex() = default;
+
+    /** @brief removes every row, keeping the column capacity. */
+    void clear();
+
+    /** @brief reserves room for the given number of rows in every column. */
+    void reserve(std::size_t rows);
+
+    /**
+     * @brief appends the primary header of a packet as a new row.
+     *
+     * @param view view over the serialized packet.
+     * @param offset byte offset of the packet in its source buffer.
+     */
+    void add(const PacketView &view, std::uint64_t offset);
+
+    /**
+     * @brief appends the primary headers of a batch of views over one buffer, see decodePrimaryHeaders().
+     *
+     * @param pData buffer holding every viewed packet, the offsets are relative to it.
+     * @param views views over the serialized packets, in order.
+     * @param count number of views.
+     */
+    void add(const std::uint8_t *pData, const PacketView *views, std::size_t count);
+
+    /**
+     * @brief appends the primary headers of the packets at the given offsets of a buffer, see decodePrimaryHeaders().
+     *
+     * @param pData buffer holding the packets.
+     * @param offsets byte offset of each packet in the buffer, in order.
+     * @param count number of packets.
+     */
+    void add(const std::uint8_t *pData, const std::uint64_t *offsets, std::size_t count);
+
+    /** @brief returns the number of rows. */
+    [[nodiscard]] std::size_t size() const { return m_offset.size(); }
+
+    /** @brief returns true if the index holds no rows. */
+    [[nodiscard]] bool empty() const { return m_offset.empty(); }
+
+    [[nodiscard]] std::uint16_t getAPID(const std::size_t row)          const { return m_identification[row] & 0x07FF;       } ///< 11 bits
+    [[nodiscard]] std::uint8_t getType(const std::size_t row)           const { return (m_identification[row] >> 12) & 0x1; } ///< 1 bits
+    [[nodiscard]] std::uint8_t getSequenceFlags(const std::size_t row)  const { return m_sequenceControl[row] >> 14;         } ///< 2 bits
+    [[nodiscard]] std::uint16_t getSequenceCount(const std::size_t row) const { return m_sequenceControl[row] & 0x3FFF;     } ///< 14 bits
+    [[nodiscard]] std::uint16_t getDataLength(const std::size_t row)    const { return m_dataLength[row];                   } ///< 16 bits
+    [[nodiscard]] std::uint64_t getOffset(const std::size_t row)        const { return m_offset[row];                       }
+
+    /** @brief returns the full length of the packet in bytes, primary header and CRC included. */
+    [[nodiscard]] std::size_t getFullPacketLength(const std::size_t row) const {
+      return static_cast<std::size_t>(m_dataLength[row]) + 8;
+    }
+
+    /** @brief returns the packet identification column, the first primary header word of every packet. */
+    [[nodiscard]] const std::vector<std::uint16_t> &getIdentificationColumn() const { return m_identification; }
+
+    /** @brief returns the sequence control column, the second primary header word of every packet. */
+    [[nodiscard]] const std::vector<std::uint16_t> &getSequenceControlColumn() const { return m_sequenceControl; }
+
+    /** @brief returns the data length column, the third primary header word of every packet. */
+    [[nodiscard]] const std::vector<std::uint16_t> &getDataLengthColumn() const { return m_dataLength; }
+
+    /** @brief returns the byte offset column. */
+    [[nodiscard]] const std::vector<std::uint64_t> &getOffsetColumn() const { return m_offset; }
+
+    /**
+     * @brief counts the packets with the given APID.
+     *
+     * @param apid 11 bits application process identifier.
+     * @return number of matching rows.
+     */
+    [[nodiscard]] std::size_t countAPID(std::uint16_t apid) const;
+
+    /**
+     * @brief returns the rows of the packets with the given APID, in order.
+     *
+     * @param apid 11 bits application process identifier.
+     * @return matching row numbers.
+     */
+    [[nodiscard]] std::vector<std::size_t> selectAPID(std::uint16_t apid) const;
+
+    /**
+     * @brief returns the rows whose sequence count does not follow the previous packet of the same APID.
+     *
+     * Sequence counts wrap from 16383 to 0. The first packet of an APID is never reported.
+     *
+     * @param apid 11 bits application process identifier.
+     * @return row numbers of the packets following a gap.
+     */
+    [[nodiscard]] std::vector<std::size_t> findSequenceGaps(std::uint16_t apid) const;
+
+    /** @brief findSequenceGaps() over every APID at once, rows are returned in order. */
+    [[nodiscard]] std::vector<std::size_t> findSequenceGaps() const;
+
+  private:
+    /** @brief decodes the headers of the count rows from first, whose offsets are already appended. */
+    void decodeRows(const std::uint8_t *pData, std::size_t first, std::size_t count);
+
+    std::vector<std::uint16_t> m_identification{};  ///< version, type, secondary header flag and APID.
+    std::vector<std::uint16_t> m_sequenceControl{}; ///< sequence flags and sequence count.
+    std::vector<std::uint16_t> m_dataLength{};      ///< primary header data length, full length - 8.
+    std::vector<std::uint64_t> m_offset{};          ///< byte offset of the packet in its source buffer.
+  };
+
+} // namespace CCSDS
+
+#endif // CCSDS_PACKET_INDEX_H
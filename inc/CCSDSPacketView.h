@@ -0,0 +1,116 @@
+// Copyright 2025-2026 ExoSpaceLabs
+// SPDX-License-Identifier: Apache-2.0
+
+#ifndef CCSDS_PACKET_VIEW_H
+#define CCSDS_PACKET_VIEW_H
+
+#include <CCSDSResult.h>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+#include "CCSDSHeader.h"
+#include "CCSDSCrc.h"
+
+namespace CCSDS {
+
+  /**
+   * @brief Non owning view over a contiguous range of bytes.
+   *
+   * The viewed memory must outlive the view, no copy of the data is made.
+   */
+  struct BufferView {
+    const std::uint8_t *data{nullptr}; ///< first viewed byte.
+    std::size_t size{0};               ///< number of viewed bytes.
+
+    [[nodiscard]] bool empty() const { return size == 0; }
+    [[nodiscard]] const std::uint8_t *begin() const { return data; }
+    [[nodiscard]] const std::uint8_t *end() const { return data + size; }
+    const std::uint8_t &operator[](const std::size_t index) const { return data[index]; }
+
+    /** @brief copies the viewed bytes into a new vector. */
+    [[nodiscard]] std::vector<std::uint8_t> toVector() const { return {begin(), end()}; }
+  };
+
+  /**
+   * @brief Read only view of a serialized CCSDS packet.
+   *
+   * The view parses a packet in place over a borrowed buffer, exposing the primary header fields,
+   * the secondary header bytes, the application data and the stored CRC without copying them.
+   * A `Packet` is only built when explicitly requested through `Packet::deserialize(const PacketView&)`.
+   *
+   * @note The buffer passed to deserialize must outlive the view.
+   */
+  class PacketView {
+  public:
+    PacketView() = default;
+
+    /**
+     * @brief Points the view at a serialized packet.
+     *
+     * The full buffer is taken as the packet, i.e. primary header, data field and CRC-16. The data
+     * length declared in the header is not enforced so that incoherent packets can still be validated.
+     *
+     * @param pData pointer to the first byte of the primary header.
+     * @param sizeData size of the packet in bytes (at least 8).
+     * @param secondaryHeaderSize number of data field bytes belonging to the secondary header.
+     * @return ResultBool
+     */
+    [[nodiscard]] ResultBool deserialize(const std::uint8_t *pData, std::size_t sizeData,
+                                         std::uint16_t secondaryHeaderSize = 0);
+
+    /** @brief Points the view at a serialized packet held by a vector, see the pointer overload. */
+    [[nodiscard]] ResultBool deserialize(const std::vector<std::uint8_t> &data, std::uint16_t secondaryHeaderSize = 0);
+
+    [[nodiscard]] std::uint8_t getVersionNumber()       const { return m_data[0] >> 5;                       } ///< 3 bits
+    [[nodiscard]] std::uint8_t getType()                const { return (m_data[0] >> 4) & 0x1;               } ///< 1 bits
+    [[nodiscard]] std::uint8_t getDataFieldHeaderFlag() const { return (m_data[0] >> 3) & 0x1;               } ///< 1 bits
+    [[nodiscard]] std::uint16_t getAPID()               const { return readWord(0) & 0x07FF;                 } ///< 11 bits
+    [[nodiscard]] std::uint8_t getSequenceFlags()       const { return m_data[2] >> 6;                       } ///< 2 bits
+    [[nodiscard]] std::uint16_t getSequenceCount()      const { return readWord(2) & 0x3FFF;                 } ///< 14 bits
+    [[nodiscard]] std::uint16_t getDataLength()         const { return readWord(4);                          } ///< 16 bits
+
+    /** @brief returns the 48 bit primary header as a 64-bit integer. */
+    [[nodiscard]] std::uint64_t getPrimaryHeader64bit() const;
+
+    /** @brief returns a decoded copy of the primary header. */
+    [[nodiscard]] Header getPrimaryHeader() const;
+
+    /** @brief returns the CRC-16 stored in the last two bytes of the packet. */
+    [[nodiscard]] std::uint16_t getCRC() const { return readWord(m_size - 2); }
+
+    /** @brief computes the CRC-16 of the viewed data field with the given configuration. */
+    [[nodiscard]] std::uint16_t computeCRC(const CRC16Config &config = {}) const;
+
+    /** @brief returns the size of the whole packet in bytes. */
+    [[nodiscard]] std::size_t getFullPacketLength() const { return m_size; }
+
+    /** @brief returns the whole packet. */
+    [[nodiscard]] BufferView getBytes() const { return {m_data, m_size}; }
+
+    /** @brief returns the 6 bytes of the primary header. */
+    [[nodiscard]] BufferView getPrimaryHeaderBytes() const { return {m_data, 6}; }
+
+    /** @brief returns the secondary header bytes, empty if no secondary header size was given. */
+    [[nodiscard]] BufferView getDataFieldHeaderBytes() const { return {m_data + 6, m_secondaryHeaderSize}; }
+
+    /** @brief returns the application data bytes. */
+    [[nodiscard]] BufferView getApplicationData() const;
+
+    /** @brief returns the full data field, i.e. secondary header and application data. */
+    [[nodiscard]] BufferView getFullDataFieldBytes() const { return {m_data + 6, m_size - 8}; }
+
+    /** @brief returns true if the view has been pointed at a packet. */
+    [[nodiscard]] bool isValid() const { return m_data != nullptr; }
+
+  private:
+    [[nodiscard]] std::uint16_t readWord(const std::size_t offset) const {
+      return static_cast<std::uint16_t>((m_data[offset] << 8) | m_data[offset + 1]);
+    }
+
+    const std::uint8_t *m_data{nullptr};    ///< first byte of the primary header.
+    std::size_t m_size{0};                  ///< full packet size in bytes.
+    std::uint16_t m_secondaryHeaderSize{0}; ///< data field bytes belonging to the secondary header.
+  };
+}
+
+#endif // CCSDS_PACKET_VIEW_H
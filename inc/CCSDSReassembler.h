@@ -0,0 +1,186 @@
+// Copyright 2025-2026 ExoSpaceLabs
+// SPDX-License-Identifier: Apache-2.0
+
+#ifndef CCSDS_REASSEMBLER_H
+#define CCSDS_REASSEMBLER_H
+
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <unordered_map>
+#include <vector>
+#include "CCSDSPacketView.h"
+#include "CCSDSResult.h"
+
+namespace CCSDS {
+
+  /**
+   * @brief Counters kept by the Reassembler, per APID and in total.
+   */
+  struct ReassemblyStatistics {
+    std::uint64_t completedUnits{0};    ///< units delivered to the sink, unsegmented packets included.
+    std::uint64_t completedBytes{0};    ///< application data bytes delivered to the sink.
+    std::uint64_t droppedSegments{0};   ///< segments discarded with an incomplete unit or out of sequence.
+    std::uint64_t duplicateSegments{0}; ///< segments repeating the last accepted sequence count, ignored.
+    std::uint64_t timedOutUnits{0};     ///< units discarded as no segment arrived within the timeout.
+    std::uint64_t overflowUnits{0};     ///< units discarded as they exceeded the unit or memory limit.
+  };
+
+  /**
+   * @class Reassembler
+   * @brief Rebuilds application data units from segmented packets, keyed by APID.
+   *
+   * Each APID holds at most one unit in progress, tracked from its FIRST through CONTINUING to its LAST
+   * segment with consecutive sequence counts (modulo 16384). The fragments are written into a per APID
+   * buffer whose capacity is kept across units, so a steady stream does not allocate. Unsegmented packets
+   * are delivered straight from the packet.
+   *
+   * Failure handling:
+   *  - a repeated segment, same sequence count as the last accepted one, is ignored as a duplicate.
+   *  - a missing segment drops the unit in progress, the following segments up to the next FIRST are dropped.
+   *  - a FIRST or unsegmented packet interrupting a unit drops the unit in progress.
+   *  - a unit without new segment for longer than the timeout is dropped, on its next segment or by expire().
+   *  - a unit exceeding the unit size limit is dropped, exceeding the memory limit drops the least recently
+   *    updated units first.
+   *
+   * Time is whatever monotonic unit the caller passes to add() and expire(), e.g. milliseconds or a packet counter.
+   */
+  class Reassembler {
+  public:
+    /**
+     * @brief Receives a complete unit, the data is valid only for the duration of the call.
+     */
+    using Sink = std::function<void(std::uint16_t apid, const std::uint8_t *pData, std::size_t sizeData)>;
+
+    Reassembler() = default;
+
+    /** @brief Constructs a reassembler delivering the complete units to the sink. */
+    explicit Reassembler(Sink sink) : m_sink(std::move(sink)) {}
+
+    /** @brief sets the destination of the complete units. */
+    void setSink(Sink sink) { m_sink = std::move(sink); }
+
+    /**
+     * set the maximum size of a single unit, larger units are dropped.
+     *
+     * @param bytes std::size_t (default 16 MiB)
+     */
+    void setMaxUnitSize(const std::size_t bytes) { m_maxUnitSize = bytes; }
+
+    /** @brief returns the maximum size of a single unit. */
+    [[nodiscard]] std::size_t getMaxUnitSize() const { return m_maxUnitSize; }
+
+    /**
+     * set the maximum number of bytes buffered by all the units in progress.
+     *
+     * @param bytes std::size_t (default 64 MiB)
+     */
+    void setMemoryLimit(const std::size_t bytes) { m_memoryLimit = bytes; }
+
+    /** @brief returns the maximum number of buffered bytes. */
+    [[nodiscard]] std::size_t getMemoryLimit() const { return m_memoryLimit; }
+
+    /**
+     * set the time after which a unit without new segment is dropped.
+     *
+     * @param timeout std::uint64_t in the caller time unit (default 0), 0 disables the timeout.
+     */
+    void setTimeout(const std::uint64_t timeout) { m_timeout = timeout; }
+
+    /** @brief returns the timeout, 0 if disabled. */
+    [[nodiscard]] std::uint64_t getTimeout() const { return m_timeout; }
+
+    /**
+     * @brief Preallocates the unit buffer of an APID, the fragments are then written without reallocation.
+     *
+     * @param apid 11 bits application process identifier.
+     * @param bytes expected size of the largest unit.
+     */
+    void reserve(const std::uint16_t apid, const std::size_t bytes) { m_streams[apid].buffer.reserve(bytes); }
+
+    /**
+     * @brief Adds the application data of a packet view, see the field overload.
+     *
+     * The secondary header size given to the view is excluded from the unit.
+     *
+     * @param packet view over the packet.
+     * @param now current time.
+     * @return ResultBool, error if the view is empty.
+     */
+    [[nodiscard]] ResultBool add(const PacketView &packet, std::uint64_t now = 0);
+
+    /**
+     * @brief Adds a packet fragment, the unit is delivered to the sink once complete.
+     *
+     * @param apid 11 bits application process identifier.
+     * @param sequenceFlags 2 bits sequence flags of the packet.
+     * @param sequenceCount 14 bits sequence count of the packet.
+     * @param pData application data of the packet.
+     * @param sizeData size of the application data in bytes.
+     * @param now current time.
+     * @return ResultBool, error if the sink is not set or the data is nullptr.
+     */
+    [[nodiscard]] ResultBool add(std::uint16_t apid, std::uint8_t sequenceFlags, std::uint16_t sequenceCount,
+                                 const std::uint8_t *pData, std::size_t sizeData, std::uint64_t now = 0);
+
+    /**
+     * @brief Drops every unit not updated within the timeout.
+     *
+     * @param now current time.
+     */
+    void expire(std::uint64_t now);
+
+    /** @brief drops the unit in progress of an APID, if any. */
+    void drop(std::uint16_t apid);
+
+    /** @brief drops every unit in progress, e.g. at the end of a stream. */
+    void flush();
+
+    /** @brief returns the number of units in progress. */
+    [[nodiscard]] std::size_t getPendingUnits() const { return m_pendingUnits; }
+
+    /** @brief returns the number of bytes buffered by the units in progress. */
+    [[nodiscard]] std::size_t getBufferedBytes() const { return m_bufferedBytes; }
+
+    /** @brief returns the counters summed over every APID. */
+    [[nodiscard]] const ReassemblyStatistics &getStatistics() const { return m_statistics; }
+
+    /** @brief returns the counters of an APID, zero if no packet of the APID was added. */
+    [[nodiscard]] ReassemblyStatistics getStatistics(std::uint16_t apid) const;
+
+  private:
+    /** @brief reassembly state of a single APID. */
+    struct Stream {
+      std::vector<std::uint8_t> buffer{};  ///< fragments of the unit in progress, capacity kept across units.
+      bool inProgress{false};              ///< a FIRST segment has been accepted.
+      std::uint16_t lastSequenceCount{0};  ///< sequence count of the last accepted segment.
+      std::uint64_t segments{0};           ///< segments held by the buffer.
+      std::uint64_t lastUpdate{0};         ///< time of the last accepted segment.
+      ReassemblyStatistics statistics{};
+    };
+
+    /** @brief adds value to a counter of the stream and to the total. */
+    void increment(Stream &stream, std::uint64_t ReassemblyStatistics::*counter, std::uint64_t value = 1);
+
+    /** @brief discards the unit in progress of a stream, its segments are counted as dropped. */
+    void discard(Stream &stream);
+
+    /** @brief delivers a complete unit and updates the counters. */
+    void deliver(std::uint16_t apid, Stream &stream, const std::uint8_t *pData, std::size_t sizeData);
+
+    /** @brief drops the least recently updated units, other than keep, until sizeData more bytes fit. */
+    void makeRoom(const Stream &keep, std::size_t sizeData);
+
+    Sink m_sink{};
+    std::unordered_map<std::uint16_t, Stream> m_streams{};
+    std::size_t m_maxUnitSize{16u << 20};
+    std::size_t m_memoryLimit{64u << 20};
+    std::uint64_t m_timeout{0};
+    std::size_t m_pendingUnits{0};
+    std::size_t m_bufferedBytes{0};
+    ReassemblyStatistics m_statistics{};
+  };
+
+} // namespace CCSDS
+
+#endif // CCSDS_REASSEMBLER_H
@@ -7,6 +7,8 @@
 #include <variant>
 #include <vector>
 #include <cstdint>
+#include <string>
+#include <string_view>
 
 //exclude includes when building for MCU
 #ifndef CCSDS_MCU
@@ -38,38 +40,145 @@ namespace CCSDS {
   };
 
   /**
-   * @brief Represents an error with both an error code and a message.
+   * @brief Returns the static description of an error code, used when an error carries no message.
    *
-   * This class is used to provide additional error context by combining
-   * an `ErrorCode` with a detailed message, allowing differentiation
-   * between multiple errors of the same type.
+   * @param code the error code.
+   * @return description with static storage duration.
+   */
+  constexpr const char *errorCodeText(const ErrorCode code) {
+    switch (code) {
+      case NONE:                          return "No error";
+      case NO_DATA:                       return "No data available";
+      case INVALID_DATA:                  return "Data is invalid";
+      case INVALID_HEADER_DATA:           return "Header data is invalid";
+      case INVALID_SECONDARY_HEADER_DATA: return "Secondary header data is invalid";
+      case INVALID_APPLICATION_DATA:      return "Application data is invalid";
+      case NULL_POINTER:                  return "Null pointer encountered";
+      case INVALID_CHECKSUM:              return "Checksum validation failed";
+      case VALIDATION_FAILURE:            return "Validation failure";
+      case TEMPLATE_SET_FAILURE:          return "Failed to set template packet";
+      case FILE_READ_ERROR:               return "Failed to read from file";
+      case FILE_WRITE_ERROR:              return "Failed to write to file";
+      case CONFIG_FILE_ERROR:             return "Configuration file error";
+      default:                            return "Unknown error";
+    }
+  }
+
+  /**
+   * @brief Represents an error with an error code, a static message and optional structured context.
+   *
+   * The message is a string literal, or any text with static storage duration, so constructing, copying and
+   * returning an error never allocates. Values describing the failure, e.g. the packet index or APID, are
+   * attached as context and only formatted into text when message() is called.
+   *
+   * @code
+   * return CCSDS::Error{CCSDS::ErrorCode::VALIDATION_FAILURE, "Validation failure for packet"}.withIndex(index);
+   * @endcode
    */
   class Error {
   public:
     /**
      * @brief Constructs an error with a given error code and message.
      * @param code The error code representing the type of error.
-     * @param message A detailed description of the error.
+     * @param message A detailed description of the error, with static storage duration.
+     */
+    constexpr Error(const ErrorCode code, const char *message)
+      : m_message(message != nullptr ? message : errorCodeText(code)), m_code(code) {
+    }
+
+    /**
+     * @brief Constructs an error described by the static text of its code, see errorCodeText().
+     * @param code The error code representing the type of error.
      */
-    Error(const ErrorCode code, std::string message)
-      : m_code(code), m_message(std::move(message)) {
+    constexpr explicit Error(const ErrorCode code) : Error(code, nullptr) {
     }
 
     /**
      * @brief Retrieves the error code.
      * @return The associated `ErrorCode`.
      */
-    [[nodiscard]] ErrorCode code() const { return m_code; }
+    [[nodiscard]] constexpr ErrorCode code() const { return m_code; }
+
+    /**
+     * @brief Retrieves the static error message, without context.
+     * @return The error description.
+     */
+    [[nodiscard]] std::string_view text() const { return m_message; }
 
     /**
-     * @brief Retrieves the error message.
+     * @brief Formats the error message followed by its context, e.g. "Validation failure (index 3, APID 100)".
      * @return The detailed error description.
      */
-    [[nodiscard]] const std::string &message() const { return m_message; }
+    [[nodiscard]] std::string message() const {
+      std::string message(m_message);
+      if (m_fields == 0) {
+        return message;
+      }
+      const char *separator = " (";
+      auto append = [&](const char *name, const std::uint32_t value) {
+        message += separator;
+        message += name;
+        message += std::to_string(value);
+        separator = ", ";
+      };
+      if (hasContext(INDEX)) append("index ", m_index);
+      if (hasContext(APID)) append("APID ", m_apid);
+      if (hasContext(EXPECTED)) append("expected ", m_expected);
+      if (hasContext(ACTUAL)) append("actual ", m_actual);
+      return message + ")";
+    }
+
+    /** @brief context values an error may carry. */
+    enum Context : std::uint8_t { INDEX = 1, APID = 2, EXPECTED = 4, ACTUAL = 8 };
+
+    /** @brief returns true if the error carries the context value. */
+    [[nodiscard]] constexpr bool hasContext(const Context field) const { return (m_fields & field) != 0; }
+
+    /** @brief returns the index context, e.g. of the failing packet, 0 if not set. */
+    [[nodiscard]] constexpr std::uint32_t index() const { return m_index; }
+
+    /** @brief returns the APID context, 0 if not set. */
+    [[nodiscard]] constexpr std::uint16_t apid() const { return m_apid; }
+
+    /** @brief returns the expected value context, 0 if not set. */
+    [[nodiscard]] constexpr std::uint32_t expected() const { return m_expected; }
+
+    /** @brief returns the actual value context, 0 if not set. */
+    [[nodiscard]] constexpr std::uint32_t actual() const { return m_actual; }
+
+    /** @brief returns a copy of the error carrying an index, e.g. of the failing packet. */
+    [[nodiscard]] constexpr Error withIndex(const std::uint64_t index) const {
+      Error error = *this;
+      error.m_index = static_cast<std::uint32_t>(index);
+      error.m_fields |= INDEX;
+      return error;
+    }
+
+    /** @brief returns a copy of the error carrying an APID. */
+    [[nodiscard]] constexpr Error withApid(const std::uint16_t apid) const {
+      Error error = *this;
+      error.m_apid = apid;
+      error.m_fields |= APID;
+      return error;
+    }
+
+    /** @brief returns a copy of the error carrying the expected and actual values of a mismatch. */
+    [[nodiscard]] constexpr Error withValues(const std::uint64_t expected, const std::uint64_t actual) const {
+      Error error = *this;
+      error.m_expected = static_cast<std::uint32_t>(expected);
+      error.m_actual = static_cast<std::uint32_t>(actual);
+      error.m_fields |= EXPECTED | ACTUAL;
+      return error;
+    }
 
   private:
-    ErrorCode m_code; ///< The error type.
-    std::string m_message; ///< A detailed message describing the error.
+    const char *m_message;       ///< A static message describing the error.
+    std::uint32_t m_index{0};    ///< Index context.
+    std::uint32_t m_expected{0}; ///< Expected value context.
+    std::uint32_t m_actual{0};   ///< Actual value context.
+    std::uint16_t m_apid{0};     ///< APID context.
+    std::uint8_t m_fields{0};    ///< Context values set, see Context.
+    ErrorCode m_code;            ///< The error type.
   };
 
   /**
@@ -97,7 +206,7 @@ namespace CCSDS {
      * @brief Constructor for failure case.
      * @param error The Error.
      */
-    Result(Error error) : data(error) {
+    Result(const Error error) : data(error) {
     }
 
     /**
@@ -5,6 +5,9 @@
 #define CCSDS_SECONDARY_HEADER_ABSTRACT_H
 
 #include <CCSDSResult.h>
+#include <algorithm>
+#include <memory>
+#include <string_view>
 #include <vector>
 #include <cstdint>
 
@@ -30,6 +33,16 @@ namespace CCSDS {
      */
     [[nodiscard]] virtual ResultBool deserialize(const std::vector<std::uint8_t> &data) = 0;
 
+    /**
+     * @brief takes a pointer to sizeData bytes and creates the header.
+     *
+     * The default implementation copies the bytes into a vector, headers override it to read in place.
+     * @return Boolean true on success or Error.
+     */
+    [[nodiscard]] virtual ResultBool deserialize(const std::uint8_t *pData, const std::size_t sizeData) {
+      return deserialize(std::vector<std::uint8_t>(pData, pData + sizeData));
+    }
+
 
     /**
      * @brief Defines how the packet secondary header is updated using the data field as reference.
@@ -53,10 +66,34 @@ namespace CCSDS {
     [[nodiscard]] virtual std::vector<std::uint8_t> serialize() const = 0; // Pure virtual method for polymorphism
 
     /**
-     * @brief Retrieves the name of the packet.
-     * @return A vector containing the header bytes. (does not include data field)
+     * @brief Writes the serialized header in place, pData must hold at least getSize() bytes.
+     *
+     * The default implementation copies the result of serialize(), headers override it to avoid the
+     * intermediate vector.
+     *
+     * @return The number of bytes written.
+     */
+    virtual std::uint16_t serializeInto(std::uint8_t *pData) const {
+      const auto data = serialize();
+      std::copy(data.begin(), data.end(), pData);
+      return static_cast<std::uint16_t>(data.size());
+    }
+
+    /**
+     * @brief Creates an independent copy of the header.
+     *
+     * Used to give each packet its own header when packets are built concurrently. The default
+     * returns nullptr, i.e. the header cannot be copied and stays shared between packet copies.
+     *
+     * @return A new header holding the same fields, or nullptr.
      */
-    [[nodiscard]] virtual std::string getType() const = 0; // Pure virtual method for polymorphism
+    [[nodiscard]] virtual std::shared_ptr<SecondaryHeaderAbstract> clone() const { return nullptr; }
+
+    /**
+     * @brief Retrieves the registered type name of the header.
+     * @return The name, valid for the lifetime of the header, without building a string.
+     */
+    [[nodiscard]] virtual std::string_view getType() const = 0; // Pure virtual method for polymorphism
 
 #ifndef CCSDS_MCU
     virtual ResultBool loadFromConfig(const Config &config) = 0;
@@ -90,12 +127,23 @@ namespace CCSDS {
     };
 
     [[nodiscard]] ResultBool deserialize(const std::vector<std::uint8_t> &data) override {m_data = data; return true;};
+    [[nodiscard]] ResultBool deserialize(const std::uint8_t *pData, const std::size_t sizeData) override {
+      m_data.assign(pData, pData + sizeData);
+      return true;
+    }
 
     [[nodiscard]] std::uint16_t getSize() const override { return m_data.size(); }
-    [[nodiscard]] std::string getType() const override { return m_type; }
+    [[nodiscard]] std::string_view getType() const override { return kType; }
 
     [[nodiscard]] std::vector<std::uint8_t> serialize() const override {return m_data;};
+    std::uint16_t serializeInto(std::uint8_t *pData) const override {
+      std::copy(m_data.begin(), m_data.end(), pData);
+      return static_cast<std::uint16_t>(m_data.size());
+    }
     void update(DataField* dataField) override {m_dataLength = m_data.size();}
+    [[nodiscard]] std::shared_ptr<SecondaryHeaderAbstract> clone() const override {
+      return std::make_shared<BufferHeader>(*this);
+    }
 #ifndef CCSDS_MCU
     ResultBool loadFromConfig(const Config &config) override{return true;};
 #endif
@@ -103,7 +151,9 @@ namespace CCSDS {
   private:
     std::vector<std::uint8_t> m_data;
     std::uint16_t m_dataLength = 0;
-    const std::string m_type = "DataOnlyHeader";
+
+  public:
+    static constexpr std::string_view kType = "DataOnlyHeader";   ///< registered type name
   };
 
 
@@ -4,26 +4,71 @@
 #ifndef CCSDS_SECONDARY_HEADER_FACTORY_H
 #define CCSDS_SECONDARY_HEADER_FACTORY_H
 
+#include <array>
+#include <atomic>
 #include <memory>
-#include <unordered_map>
 #include <functional>
 #include <string>
+#include <string_view>
 #include "CCSDSSecondaryHeaderAbstract.h"  // Base class header
 
 namespace CCSDS {
 
+/**
+ * @enum SecondaryHeaderTypeId
+ * @brief Integer identifier assigned to a secondary header type on registration.
+ *
+ * Identifiers are assigned in registration order, the process wide registry registers the built-in headers
+ * first so they always hold the values below. Custom headers receive the following identifiers, see
+ * SecondaryHeaderFactory::getTypeId().
+ */
+enum SecondaryHeaderTypeId : std::uint16_t {
+  BUFFER_HEADER_TYPE_ID = 0,          ///< BufferHeader, registered as "DataOnlyHeader"
+  PUSA_TYPE_ID = 1,                   ///< PusA
+  PUSB_TYPE_ID = 2,                   ///< PusB
+  PUSC_TYPE_ID = 3,                   ///< PusC
+  INVALID_TYPE_ID = 0xFFFF            ///< Not a registered type
+};
+
 /**
  * @class SecondaryHeaderFactory
- * @brief A singleton factory class responsible for registering and creating instances of `SecondaryHeaderAbstract` objects.
+ * @brief A factory class responsible for registering and creating instances of `SecondaryHeaderAbstract` objects.
+ *
+ * This factory allows clients to register new types of headers, check if a header type is registered, and create
+ * instances of registered header types. Every registered type is assigned a SecondaryHeaderTypeId, creating by
+ * identifier is an index into the registered creators, the type name is only hashed when resolving it to an
+ * identifier.
  *
- * This factory allows clients to register new types of headers, check if a header type is registered, and create instances of registered header types.
+ * Every call to create() returns a new header instance, so packets deserialized with the same type never share
+ * their secondary header.
+ *
+ * Registered types are immutable and hold at most kMaxTypes entries. Registrations are serialized by a spin lock
+ * and published by the release of the type count, lookups read the entries below the acquired count without
+ * locking, so a factory may be read from any thread while types are being added. All data fields share the
+ * factory returned by instance(), which holds the built-in headers.
  */
 class SecondaryHeaderFactory {
 public:
   /**
-   * @brief Default constructor for the factory.
+   * @brief Maximum number of registered types, built-in headers included.
+   */
+  static constexpr std::size_t kMaxTypes = 64;
+
+  /**
+   * @brief Default constructor for the factory, no type is registered.
    */
   SecondaryHeaderFactory() = default;
+  SecondaryHeaderFactory(const SecondaryHeaderFactory &) = delete;            ///< registered types are never copied
+  SecondaryHeaderFactory &operator=(const SecondaryHeaderFactory &) = delete;
+
+  /**
+   * @brief Returns the process wide factory used by every data field.
+   *
+   * Built on first use with BufferHeader, PusA, PusB and PusC registered under their SecondaryHeaderTypeId.
+   *
+   * @return SecondaryHeaderFactory& .
+   */
+  static SecondaryHeaderFactory &instance();
 
   /**
    * @typedef CreatorFunc
@@ -32,32 +77,86 @@ public:
   using CreatorFunc = std::function<std::shared_ptr<SecondaryHeaderAbstract>()>;
 
   /**
-   * @brief Registers a new header type with its creation function.
+   * @brief Registers a new header type using a prototype.
    *
-   * This function adds a new header type to the factory by associating the header's type string with a shared pointer to the header.
+   * Instances are created by cloning the prototype, headers that do not implement clone() fall back to
+   * returning the prototype itself, which is then shared by all the packets using the type.
+   * Registering a type name again with the same size and length mode keeps the first registration and its
+   * identifier.
    *
    * @param header A shared pointer to a `SecondaryHeaderAbstract` object to register.
-     * @return ResultBool.
+   * @return ResultBool, error if the header is null, the factory is full or the type name is already registered
+   * with a different layout.
    */
   ResultBool registerType(std::shared_ptr<SecondaryHeaderAbstract> header) {
     RET_IF_ERR_MSG(!header, INVALID_HEADER_DATA, "Cannot register, invalid Header provided.");
-    m_creators[header->getType()] = std::move(header);
+    const auto type = header->getType();
+    const TypeInfo info{header->getSize(), header->variableLength};
+    FORWARD_RESULT(registerCreator(type, info, [prototype = std::move(header)]() {
+      auto instance = prototype->clone();
+      return instance ? instance : prototype;
+    }));
+    return true;
+  }
+
+  /**
+   * @brief Registers a new header type, instances are default constructed.
+   *
+   * Registering a type name again with the same size and length mode keeps the first registration and its
+   * identifier.
+   *
+   * @tparam T The header type, derived from `SecondaryHeaderAbstract`.
+   * @return ResultBool, error if the factory is full or the type name is already registered with a different
+   * layout.
+   */
+  template <typename T>
+  ResultBool registerType() {
+    T prototype;
+    FORWARD_RESULT(registerCreator(prototype.getType(), {prototype.getSize(), prototype.variableLength},
+                    []() -> std::shared_ptr<SecondaryHeaderAbstract> { return std::make_shared<T>(); }));
     return true;
   }
 
   /**
-   * @brief Creates an instance of a registered header type.
+   * @brief Creates a new instance of a registered header type.
+   *
+   * @param typeId The identifier of the header type, see getTypeId().
+   * @return A shared pointer to a new `SecondaryHeaderAbstract` object, or `nullptr` if the type is not registered.
+   */
+  [[nodiscard]] std::shared_ptr<SecondaryHeaderAbstract> create(const SecondaryHeaderTypeId typeId) const {
+    if (typeIsRegistered(typeId)) {
+      return m_entries[typeId].creator();
+    }
+    return nullptr;
+  }
+
+  /**
+   * @brief Creates a new instance of a registered header type.
    *
    * This function searches for the header type by its string identifier and returns a new instance of the registered header.
    *
    * @param type A string representing the header type to create.
    * @return A shared pointer to a `SecondaryHeaderAbstract` object, or `nullptr` if the type is not registered.
    */
-  std::shared_ptr<SecondaryHeaderAbstract> create(const std::string& type) {
-    if (const auto it = m_creators.find(type); it != m_creators.end()) {
-      return it->second; // Call the stored creation function
+  [[nodiscard]] std::shared_ptr<SecondaryHeaderAbstract> create(const std::string_view type) const {
+    return create(getTypeId(type));
+  }
+
+  /**
+   * @brief Resolves a header type name to its identifier.
+   *
+   * @param type A string representing the header type.
+   * @return The identifier, or INVALID_TYPE_ID if the type is not registered.
+   */
+  [[nodiscard]] SecondaryHeaderTypeId getTypeId(const std::string_view type) const {
+    // a handful of types are registered, a scan of the names is cheaper than hashing the key.
+    const auto count = m_count.load(std::memory_order_acquire);
+    for (std::uint16_t typeId = 0; typeId < count; ++typeId) {
+      if (m_entries[typeId].type == type) {
+        return static_cast<SecondaryHeaderTypeId>(typeId);
+      }
     }
-    return nullptr; // Return nullptr if type not found
+    return INVALID_TYPE_ID;
   }
 
   /**
@@ -68,20 +167,88 @@ public:
    * @param type A string representing the header type to check.
    * @return `true` if the type is registered, `false` otherwise.
    */
-  bool typeIsRegistered(const std::string& type) {
-    if (const auto it = m_creators.find(type); it != m_creators.end()) {
-      return true; // return true if found
-    }
-    return false; // Return false if type not found
+  [[nodiscard]] bool typeIsRegistered(const std::string_view type) const {
+    return getTypeId(type) != INVALID_TYPE_ID;
+  }
+
+  /**
+   * @brief Checks if a header type identifier is registered.
+   *
+   * @param typeId The identifier to check.
+   * @return `true` if the type is registered, `false` otherwise.
+   */
+  [[nodiscard]] bool typeIsRegistered(const SecondaryHeaderTypeId typeId) const {
+    return typeId < m_count.load(std::memory_order_acquire);
+  }
+
+  /**
+   * @brief Returns the size in bytes of a new instance of the type, the minimum size for variable length types.
+   *
+   * @param typeId The identifier of a registered type.
+   * @return The size, 0 if the type is not registered.
+   */
+  [[nodiscard]] std::uint16_t getSize(const SecondaryHeaderTypeId typeId) const {
+    return typeIsRegistered(typeId) ? m_entries[typeId].info.size : 0;
   }
 
-private:
   /**
-   * @brief A map of header types to their corresponding `SecondaryHeaderAbstract` objects.
+   * @brief Checks if instances of the type take their size from the deserialized data.
    *
-   * This private member stores the registered header types along with their corresponding shared pointers.
+   * @param typeId The identifier of a registered type.
+   * @return `true` if the type has a variable length, `false` otherwise.
+   */
+  [[nodiscard]] bool isVariableLength(const SecondaryHeaderTypeId typeId) const {
+    return typeIsRegistered(typeId) && m_entries[typeId].info.variableLength;
+  }
+
+private:
+  /**
+   * @brief Layout of a registered type, taken from its prototype so it can be queried without creating an instance.
+   */
+  struct TypeInfo {
+    std::uint16_t size{0};
+    bool variableLength{false};
+
+    bool operator==(const TypeInfo &other) const { return size == other.size && variableLength == other.variableLength; }
+  };
+
+  /**
+   * @brief A registered type, written once before its identifier is published.
+   */
+  struct Entry {
+    std::string type{};
+    CreatorFunc creator{};
+    TypeInfo info{};
+  };
+
+  /**
+   * @brief Stores the creator of a type under the next identifier, an already registered type name is kept
+   * if its layout matches and rejected otherwise.
    */
-  std::unordered_map<std::string, std::shared_ptr<SecondaryHeaderAbstract> > m_creators;
+  ResultBool registerCreator(const std::string_view type, const TypeInfo& info, CreatorFunc creator) {
+    while (m_registering.test_and_set(std::memory_order_acquire)) {
+    }
+    const auto count = m_count.load(std::memory_order_relaxed);
+    if (const auto typeId = getTypeId(type); typeId != INVALID_TYPE_ID) {
+      const bool sameLayout = m_entries[typeId].info == info;
+      m_registering.clear(std::memory_order_release);
+      RET_IF_ERR_MSG(!sameLayout, INVALID_SECONDARY_HEADER_DATA,
+                     "Cannot register, type name already registered with a different layout.");
+      return true;
+    }
+    if (count == kMaxTypes) {
+      m_registering.clear(std::memory_order_release);
+      return Error{INVALID_SECONDARY_HEADER_DATA, "Cannot register, the secondary header factory is full."};
+    }
+    m_entries[count] = Entry{std::string(type), std::move(creator), info};
+    m_count.store(static_cast<std::uint16_t>(count + 1), std::memory_order_release);
+    m_registering.clear(std::memory_order_release);
+    return true;
+  }
+
+  std::array<Entry, kMaxTypes> m_entries{};                    ///< Registered types indexed by type id
+  std::atomic<std::uint16_t> m_count{0};                       ///< Published entries, read with acquire ordering
+  std::atomic_flag m_registering = ATOMIC_FLAG_INIT;           ///< Serializes the registrations
 };
 
 } // namespace CCSDS
@@ -0,0 +1,166 @@
+// Copyright 2025-2026 ExoSpaceLabs
+// SPDX-License-Identifier: Apache-2.0
+
+#ifndef CCSDS_STREAM_DECODER_H
+#define CCSDS_STREAM_DECODER_H
+
+#include <CCSDSResult.h>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+#include "CCSDSPacketView.h"
+
+namespace CCSDS {
+
+  /**
+   * @class StreamDecoder
+   * @brief Incremental packet framer, bytes are pushed in arbitrary chunks and packets pulled as views.
+   *
+   * Packets are located with the same sync pattern and header data length logic used by
+   * Manager::load(). Packets fully contained in a pushed chunk are returned as views over the
+   * caller's memory. Only a packet straddling two chunks is assembled in a small carry-over
+   * buffer, bounded by the largest possible packet (sync pattern + 65543 bytes).
+   *
+   * Typical usage:
+   * @code
+   * decoder.push(chunk, chunkSize);
+   * PacketView view;
+   * while (true) {
+   *   auto res = decoder.next(view);   // error on sync pattern mismatch
+   *   if (!res.has_value() || !res.value()) break;
+   *   // use view, valid until the next call to next() or push()
+   * }
+   * @endcode
+   */
+  class StreamDecoder {
+  public:
+    StreamDecoder() = default;
+
+    /**
+     * set sync pattern expected before each CCSDS packet.
+     *
+     * @param syncPattern std::uint32_t (default 0x1ACFFC1D)
+     */
+    void setSyncPattern(const std::uint32_t syncPattern) { m_syncPattern = syncPattern; }
+
+    /** @brief returns the currently set sync pattern. */
+    [[nodiscard]] std::uint32_t getSyncPattern() const { return m_syncPattern; }
+
+    /**
+     * enable sync pattern checking in front of each packet.
+     *
+     * @param enable bool (default false)
+     */
+    void setSyncPatternEnable(const bool enable) { m_syncPattEnable = enable; }
+
+    /** @brief returns the current settings of the sync pattern enable */
+    [[nodiscard]] bool getSyncPatternEnable() const { return m_syncPattEnable; }
+
+    /**
+     * enable resynchronisation on sync pattern mismatch.
+     *
+     * Instead of failing, the decoder scans ahead for the next sync pattern and skips the corrupt
+     * region in between. Only effective when the sync pattern is enabled.
+     *
+     * @param enable bool (default false)
+     */
+    void setResyncEnable(const bool enable) { m_resyncEnable = enable; }
+
+    /** @brief returns the current settings of the resynchronisation enable */
+    [[nodiscard]] bool getResyncEnable() const { return m_resyncEnable; }
+
+    /** @brief returns the number of corrupt regions skipped while resynchronising. */
+    [[nodiscard]] std::uint64_t getSkippedRegions() const { return m_skippedRegions; }
+
+    /** @brief returns the number of bytes skipped while resynchronising. */
+    [[nodiscard]] std::uint64_t getSkippedBytes() const { return m_skippedBytes; }
+
+    /**
+     * @brief Finds the first occurrence of a 4 byte big endian sync pattern in a buffer.
+     *
+     * Candidates are located 16 or 32 bytes at a time with SSE2/AVX2 on x86-64 or NEON on
+     * aarch64, other targets fall back to memchr.
+     *
+     * @param pData buffer to search.
+     * @param sizeData size of the buffer in bytes.
+     * @param syncPattern the pattern to search for.
+     * @return offset of the first complete match, sizeData if there is none.
+     */
+    [[nodiscard]] static size_t findSyncPattern(const std::uint8_t *pData, size_t sizeData, std::uint32_t syncPattern);
+
+    /**
+     * @brief Provides the next chunk of the stream.
+     *
+     * The chunk is borrowed, not copied: it must stay valid until next() returns false. Bytes of a
+     * previous chunk that have not been consumed yet are moved to the carry-over buffer first.
+     *
+     * @param pData pointer to the chunk.
+     * @param sizeData size of the chunk in bytes.
+     */
+    void push(const std::uint8_t *pData, size_t sizeData);
+
+    /** @brief Provides the next chunk of the stream held by a vector, see the pointer overload. */
+    void push(const std::vector<std::uint8_t> &data) { push(data.data(), data.size()); }
+
+    /**
+     * @brief Pulls the next complete packet.
+     *
+     * @param view set to the next packet, valid until the following call to next() or push().
+     * @return true if a packet was found, false if more data must be pushed, Error on a sync pattern mismatch
+     * unless resynchronisation is enabled.
+     */
+    [[nodiscard]] Result<bool> next(PacketView &view);
+
+    /** @brief returns the number of bytes received but not returned as packets yet. */
+    [[nodiscard]] size_t getBufferedBytes() const;
+
+    /** @brief returns the number of packets returned since the last reset. */
+    [[nodiscard]] std::uint64_t getPacketCount() const { return m_packetCount; }
+
+    /** @brief drops the bytes not returned as packets yet, accounting them as skipped, e.g. at the end of a stream. */
+    void skipBuffered();
+
+    /** @brief drops any buffered data and resets the counters, settings are kept. */
+    void reset();
+
+  private:
+    /** @brief number of bytes preceding the primary header, i.e. the sync pattern if enabled. */
+    [[nodiscard]] size_t getPrefixSize() const { return m_syncPattEnable ? 4 : 0; }
+
+    /** @brief checks the sync pattern at the given position, if enabled. */
+    [[nodiscard]] bool syncPatternMatches(const std::uint8_t *pData) const;
+
+    /** @brief moves bytes from the pushed chunk to the carry-over buffer until it holds size bytes. */
+    bool fillCarry(size_t size);
+
+    /** @brief moves the unconsumed part of the pushed chunk to the carry-over buffer. */
+    void stashInput();
+
+    /** @brief returns the byte at position index of the carry-over buffer followed by the pushed chunk. */
+    [[nodiscard]] std::uint8_t pendingByte(size_t index) const;
+
+    /** @brief accounts for bytes dropped while resynchronising, opening a new region if needed. */
+    void skip(size_t size);
+
+    /** @brief drops carry-over bytes up to the next sync pattern, or a candidate completed by further data. */
+    void resyncCarry();
+
+    /** @brief drops pushed bytes up to the next sync pattern, keeping a possible partial pattern at the end. */
+    void resyncInput();
+
+    const std::uint8_t *m_input{nullptr};   ///< currently pushed chunk, borrowed.
+    size_t m_inputSize{0};                  ///< size of the pushed chunk.
+    size_t m_inputOffset{0};                ///< first byte of the pushed chunk not consumed yet.
+    std::vector<std::uint8_t> m_carry{};    ///< partial packet straddling two chunks.
+    bool m_carryReturned{false};            ///< carry holds a packet already returned as view.
+    bool m_syncPattEnable{false};           ///< sync pattern expected before each packet (default: false).
+    bool m_resyncEnable{false};             ///< skip to the next sync pattern on mismatch (default: false).
+    bool m_skipping{false};                 ///< currently inside a skipped region.
+    std::uint32_t m_syncPattern{0x1ACFFC1D};
+    std::uint64_t m_packetCount{0};
+    std::uint64_t m_skippedRegions{0};
+    std::uint64_t m_skippedBytes{0};
+  };
+}
+
+#endif // CCSDS_STREAM_DECODER_H
@@ -0,0 +1,127 @@
+// Copyright 2025-2026 ExoSpaceLabs
+// SPDX-License-Identifier: Apache-2.0
+
+#ifndef CCSDS_STREAM_ENCODER_H
+#define CCSDS_STREAM_ENCODER_H
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+#include "CCSDSPacket.h"
+#include "CCSDSResult.h"
+
+namespace CCSDS {
+
+  /**
+   * @class StreamEncoder
+   * @brief Segments an application data stream of known size into packets, one chunk at a time.
+   *
+   * The output is byte identical to Manager::setApplicationData() followed by Manager::getPacketsBuffer()
+   * over the whole stream. As the stream size is declared up front, the sequence flags, sequence count and
+   * encoded size of every packet only depend on its position, so chunks are encoded independently of each
+   * other and in any order. encode() is const and may be called concurrently when isConcurrent() is true,
+   * each call then works on its own copy of the template.
+   *
+   * Chunks must start on a packet boundary, i.e. at a multiple of getMaxBytesPerPacket() in the stream.
+   *
+   * Typical usage:
+   * @code
+   * CCSDS::StreamEncoder encoder;
+   * encoder.setTemplate(templatePacket);
+   * encoder.begin(fileSize);
+   * const std::size_t chunkSize = encoder.getMaxBytesPerPacket() * 1024;
+   * for (std::uint64_t offset = 0; offset < fileSize; offset += chunkSize) {
+   *   // read the chunk at offset, then
+   *   output.clear();
+   *   encoder.encode(offset, chunk.data(), chunk.size(), output);
+   * }
+   * @endcode
+   */
+  class StreamEncoder {
+  public:
+    StreamEncoder() = default;
+
+    /**
+     * @brief Sets the template of the encoded packets, its data field size limits the bytes per packet.
+     *
+     * @param templatePacket template packet, see Manager::setPacketTemplate().
+     * @return ResultBool, error if the template leaves no room for application data.
+     */
+    [[nodiscard]] ResultBool setTemplate(const Packet &templatePacket);
+
+    /**
+     * set sync pattern inserted before each CCSDS packet.
+     *
+     * @param syncPattern std::uint32_t (default 0x1ACFFC1D)
+     */
+    void setSyncPattern(const std::uint32_t syncPattern) { m_syncPattern = syncPattern; }
+
+    /** @brief returns the sync pattern. */
+    [[nodiscard]] std::uint32_t getSyncPattern() const { return m_syncPattern; }
+
+    /**
+     * enable sync pattern insertion in front of each packet.
+     *
+     * @param enable bool (default false)
+     */
+    void setSyncPatternEnable(const bool enable) { m_syncPattEnable = enable; }
+
+    /** @brief returns the current settings of the sync pattern enable */
+    [[nodiscard]] bool getSyncPatternEnable() const { return m_syncPattEnable; }
+
+    /**
+     * @brief Starts a stream of the given size.
+     *
+     * @param sizeData total application data bytes of the stream.
+     * @param sequenceCount sequence count preceding the stream, 0 matches a new Manager.
+     * @return ResultBool, error if no template is set or the stream is empty.
+     */
+    [[nodiscard]] ResultBool begin(std::uint64_t sizeData, std::uint16_t sequenceCount = 0);
+
+    /** @brief returns the application data bytes carried by every packet but the last. */
+    [[nodiscard]] std::uint16_t getMaxBytesPerPacket() const { return m_maxBytesPerPacket; }
+
+    /** @brief returns the number of packets of the stream. */
+    [[nodiscard]] std::uint64_t getPacketCount() const;
+
+    /** @brief returns the encoded size of the whole stream, sync patterns included. */
+    [[nodiscard]] std::uint64_t getEncodedSize() const { return getEncodedSize(0, m_sizeData); }
+
+    /**
+     * @brief Returns the encoded size of a chunk, sync patterns included.
+     *
+     * @param offset position of the chunk in the stream, on a packet boundary.
+     * @param sizeData size of the chunk in bytes.
+     */
+    [[nodiscard]] std::uint64_t getEncodedSize(std::uint64_t offset, std::uint64_t sizeData) const;
+
+    /** @brief returns true if encode() may be called from several threads at once. */
+    [[nodiscard]] bool isConcurrent() const { return m_concurrent; }
+
+    /**
+     * @brief Encodes a chunk of the stream and appends the packets to the buffer.
+     *
+     * @param offset position of the chunk in the stream, on a packet boundary.
+     * @param pData pointer to the chunk.
+     * @param sizeData size of the chunk in bytes, a multiple of getMaxBytesPerPacket() except for the last chunk.
+     * @param buffer destination, the packets are appended.
+     * @return ResultBool, error if the chunk is not aligned or exceeds the stream.
+     */
+    [[nodiscard]] ResultBool encode(std::uint64_t offset, const std::uint8_t *pData, std::size_t sizeData,
+                                    std::vector<std::uint8_t> &buffer) const;
+
+  private:
+    Packet m_templatePacket{};
+    bool m_templateIsSet{false};
+    bool m_concurrent{true};            ///< the template secondary header can be detached by each call.
+    std::uint16_t m_maxBytesPerPacket{0};
+    std::uint16_t m_packetOverhead{0};  ///< primary header, secondary header and CRC bytes of every packet.
+    std::uint32_t m_syncPattern{0x1ACFFC1D};
+    bool m_syncPattEnable{false};
+    std::uint64_t m_sizeData{0};
+    std::uint16_t m_sequenceCount{0};   ///< sequence count preceding the stream.
+  };
+
+} // namespace CCSDS
+
+#endif // CCSDS_STREAM_ENCODER_H
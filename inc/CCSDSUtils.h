@@ -25,6 +25,22 @@ uint16_t crc16(const std::vector<std::uint8_t> &data,
                std::uint16_t finalXorValue = 0x0000
 );
 
+/**
+ * @brief Computes the CRC-16 checksum for a given raw buffer with configurable parameters.
+ *
+ * @param pData Pointer to the bytes to compute the checksum for.
+ * @param sizeData Number of bytes pointed to by pData.
+ * @param polynomial The polynomial used for the CRC calculation (default: CCSDS CRC-16 polynomial 0x1021).
+ * @param initialValue The initial value of the CRC register (default: 0xFFFF).
+ * @param finalXorValue The final XOR value applied to the CRC result (default: 0x0000).
+ * @return The computed 16-bit CRC value.
+ */
+uint16_t crc16(const std::uint8_t *pData, size_t sizeData,
+               std::uint16_t polynomial = 0x1021,
+               std::uint16_t initialValue = 0xFFFF,
+               std::uint16_t finalXorValue = 0x0000
+);
+
 
 /**
  * Tests if str ends with suffix.
@@ -135,6 +151,8 @@ CCSDS::ResultBuffer readBinaryFile(const std::string& filename);
 /**
  * @brief filesystem check fore file existence prepared for both windows and linux.
  *
+ * Only the file metadata is queried (stat), true if the path names a regular file.
+ *
  * @param fileName std::string
  * @return bool
  */
@@ -7,6 +7,7 @@
 #define CCSDS_VALIDATOR_H
 
 #include "CCSDSPacket.h"
+#include "CCSDSPacketView.h"
 
 namespace CCSDS {
   /**
@@ -50,6 +51,48 @@ namespace CCSDS {
      */
     bool validate(const Packet &packet);
 
+    /**
+     * @brief Validates a packet view in place, without materializing a Packet.
+     *
+     * Performs the same checks and produces the same report as validating the equivalent packet.
+     *
+     * @param packet The packet view to validate.
+     * @return True if the packet passes validation, otherwise false.
+     */
+    bool validate(const PacketView &packet);
+
+    /**
+     * @brief Validates a batch of packet views, spreading the per packet checks over threads.
+     *
+     * Length, CRC and template checks do not depend on other packets and run concurrently, the sequence
+     * count continuity check is then applied in order in a single pass. The reports are identical to
+     * calling validate() on each view in turn, getReport() holds the report of the last packet.
+     *
+     * @param packets first packet view of the batch.
+     * @param count number of packet views.
+     * @return True if all packets pass validation, otherwise false.
+     */
+    bool validateAll(const PacketView *packets, size_t count);
+
+    /** @brief Validates a batch of packet views held by a vector, see the pointer overload. */
+    bool validateAll(const std::vector<PacketView> &packets) { return validateAll(packets.data(), packets.size()); }
+
+    /**
+     * @brief Sets the number of threads used by validateAll. when building for MCU the batch is always
+     * validated serially.
+     *
+     * @param count std::uint32_t (default 1), 0 selects the number of hardware threads.
+     */
+    void setThreadCount(const std::uint32_t count) { m_threadCount = count; }
+
+    /** @brief returns the configured number of threads. */
+    [[nodiscard]] std::uint32_t getThreadCount() const { return m_threadCount; }
+
+    /**
+     * @brief Returns the reports of the last validateAll call, one per packet in order, see getReport().
+     */
+    [[nodiscard]] const std::vector<std::vector<bool>> &getReports() const { return m_reports; }
+
     /**
      * @brief Returns a report of performed validation checks.
      *
@@ -73,12 +116,48 @@ namespace CCSDS {
     void clear();
 
   private:
+    /**
+     * @brief Runs the header checks shared by the packet and packet view validation and fills the report.
+     *
+     * @param toValidateHeader primary header of the packet being validated.
+     * @param dataFieldBytesSize actual size of the data field.
+     * @param crcMatches whether the stored CRC-16 matches the one computed over the data field.
+     * @return True if all enabled checks passed.
+     */
+    bool validateHeader(Header toValidateHeader, size_t dataFieldBytesSize, bool crcMatches);
+
+    /**
+     * @brief Fills the report entries that do not depend on previously validated packets, all but index [3].
+     *
+     * @param toValidateHeader primary header of the packet being validated.
+     * @param dataFieldBytesSize actual size of the data field.
+     * @param crcMatches whether the stored CRC-16 matches the one computed over the data field.
+     * @param templateHeader primary header of the template packet, only read if validating against it.
+     * @param report set to the report of the packet.
+     */
+    void checkPacket(Header toValidateHeader, size_t dataFieldBytesSize, bool crcMatches, Header templateHeader,
+                     std::vector<bool> &report) const;
+
+    /**
+     * @brief Fills report index [3] and advances the sequence counter for segmented packets.
+     *
+     * @param sequenceFlags sequence flags of the packet being validated.
+     * @param sequenceCount sequence count of the packet being validated.
+     * @param report report of the packet.
+     */
+    void checkSequenceCount(std::uint8_t sequenceFlags, std::uint16_t sequenceCount, std::vector<bool> &report);
+
+    /** @brief returns the template primary header if validating against it, an empty header otherwise. */
+    Header getTemplateHeader();
+
     Packet m_templatePacket;               ///< Template packet used for validation.
     bool m_validatePacketCoherence{true};  ///< Whether to validate packet length and CRC (default is true).
     bool m_validateAgainstTemplate{false}; ///< Whether to validate against the template packet (default is false).
     bool m_validateSegmentedCount{true};  ///< Whether to validate the count of segmented packets.
     std::uint16_t m_sequenceCounter{1};         ///< Counter for segmented Packets
     std::vector<bool> m_report{};          ///< List of boolean results representing performed checks.
+    std::vector<std::vector<bool>> m_reports{}; ///< Reports of the last batch validation, one per packet.
+    std::uint32_t m_threadCount{1};        ///< Threads used for batch validation, 0 for the hardware threads.
     size_t m_reportSize{6};                ///< Expected size of the validation report.
     CRC16Config m_CRCConfig;
   };
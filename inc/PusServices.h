@@ -7,6 +7,7 @@
 #include "CCSDSSecondaryHeaderAbstract.h"
 #include "CCSDSSecondaryHeaderFactory.h"
 #include "CCSDSResult.h"
+#include <string_view>
 
 //exclude includes when building for MCU
 #ifndef CCSDS_MCU
@@ -48,12 +49,17 @@
     [[nodiscard]] std::uint8_t getServiceSubtype() const          { return m_serviceSubType;   }
     [[nodiscard]] std::uint8_t getSourceID()       const          { return m_sourceID;         }
     [[nodiscard]] std::uint16_t getDataLength()    const          { return m_dataLength;       }
-    [[nodiscard]] std::uint16_t getSize()          const override { return m_size;             }
-    [[nodiscard]] std::string getType()            const override { return m_type;          }
+    [[nodiscard]] std::uint16_t getSize()          const override { return kSize;              }
+    [[nodiscard]] std::string_view getType()       const override { return kType;              }
 
     [[nodiscard]] std::vector<std::uint8_t> serialize() const override;
+    std::uint16_t serializeInto(std::uint8_t *pData) const override;
     [[nodiscard]] CCSDS::ResultBool    deserialize( const std::vector<std::uint8_t> &data ) override;
+    [[nodiscard]] CCSDS::ResultBool    deserialize( const std::uint8_t *pData, std::size_t sizeData ) override;
     void update(CCSDS::DataField* dataField) override;
+    [[nodiscard]] std::shared_ptr<CCSDS::SecondaryHeaderAbstract> clone() const override {
+      return std::make_shared<PusA>(*this);
+    }
 
 #ifndef CCSDS_MCU
     CCSDS::ResultBool loadFromConfig(const ::Config &cfg) override;
@@ -67,8 +73,9 @@
     std::uint8_t m_sourceID{};           // Source ID	          8	        ID of the source (e.g., satellite or sensor)
     std::uint16_t m_dataLength{};        // Data Length	        16	      Length of the telemetry data in bytes
 
-    const std::string m_type = "PusA";   // Static registration (automatically called when the program starts)
-    const std::uint16_t m_size = 6;      // bytes
+  public:
+    static constexpr std::string_view kType = "PusA";   ///< registered type name
+    static constexpr std::uint16_t kSize = 6;           ///< bytes
   };
 
   /**
@@ -109,12 +116,17 @@
     [[nodiscard]] std::uint8_t getSourceID()       const          { return m_sourceID;         }
     [[nodiscard]] std::uint16_t getEventID()       const          { return m_eventID;          }
     [[nodiscard]] std::uint16_t getDataLength()    const          { return m_dataLength;       }
-    [[nodiscard]] std::uint16_t getSize()          const override { return m_size;             }
-    [[nodiscard]] std::string getType()            const override { return m_type;          }
+    [[nodiscard]] std::uint16_t getSize()          const override { return kSize;              }
+    [[nodiscard]] std::string_view getType()       const override { return kType;              }
 
     [[nodiscard]] std::vector<std::uint8_t> serialize() const override;
+    std::uint16_t serializeInto(std::uint8_t *pData) const override;
     [[nodiscard]] CCSDS::ResultBool    deserialize( const std::vector<std::uint8_t> &data ) override;
+    [[nodiscard]] CCSDS::ResultBool    deserialize( const std::uint8_t *pData, std::size_t sizeData ) override;
     void update(CCSDS::DataField* dataField) override;
+    [[nodiscard]] std::shared_ptr<CCSDS::SecondaryHeaderAbstract> clone() const override {
+      return std::make_shared<PusB>(*this);
+    }
 
 #ifndef CCSDS_MCU
     CCSDS::ResultBool loadFromConfig(const ::Config &cfg) override;
@@ -128,8 +140,9 @@
     std::uint16_t m_eventID{};            // Event ID	          16	      ID of the event being reported
     std::uint16_t m_dataLength{};         // Data Length	        16	      Length of the event data in bytes
 
-    const std::string m_type = "PusB";    // Static registration (automatically called when the program starts)
-    const std::uint16_t m_size = 8;       // bytes
+  public:
+    static constexpr std::string_view kType = "PusB";   ///< registered type name
+    static constexpr std::uint16_t kSize = 8;           ///< bytes
   };
 
   /**
@@ -172,12 +185,17 @@
     [[nodiscard]] std::uint8_t getSourceID()               const          { return m_sourceID;                 }
     [[nodiscard]] std::vector<std::uint8_t> getTimeCode()  const          { return m_timeCode;              }
     [[nodiscard]] std::uint16_t getDataLength()            const          { return m_dataLength;               }
-    [[nodiscard]] std::uint16_t getSize()                  const override { return m_size + m_timeCode.size(); }
-    [[nodiscard]] std::string getType()               const override { return m_type;                  }
+    [[nodiscard]] std::uint16_t getSize()                  const override { return kSize + m_timeCode.size(); }
+    [[nodiscard]] std::string_view getType()               const override { return kType;                    }
 
     [[nodiscard]] std::vector<std::uint8_t> serialize() const override;
+    std::uint16_t serializeInto(std::uint8_t *pData) const override;
     [[nodiscard]] CCSDS::ResultBool    deserialize( const std::vector<std::uint8_t> &data ) override;
+    [[nodiscard]] CCSDS::ResultBool    deserialize( const std::uint8_t *pData, std::size_t sizeData ) override;
     void update(CCSDS::DataField* dataField) override;
+    [[nodiscard]] std::shared_ptr<CCSDS::SecondaryHeaderAbstract> clone() const override {
+      return std::make_shared<PusC>(*this);
+    }
 
 #ifndef CCSDS_MCU
     CCSDS::ResultBool loadFromConfig(const ::Config &cfg) override;
@@ -191,9 +209,9 @@
     std::vector<std::uint8_t> m_timeCode{};  // Time Code	          16	      Time code value, depending on the system
     std::uint16_t m_dataLength{};            // Data Length	        16	      Length of the time data in bytes
 
-    const std::string m_type = "PusC";       // Static registration (automatically called when the program starts)
-    const std::uint16_t m_size = 6;          // bytes minimum size
-
+  public:
+    static constexpr std::string_view kType = "PusC";   ///< registered type name
+    static constexpr std::uint16_t kSize = 6;           ///< bytes minimum size, without time code
   };
 
 
@@ -4,6 +4,10 @@
 #ifndef EXEC_UTILS_H
 #define EXEC_UTILS_H
 #include <set>
+#include <fstream>
+#include <functional>
+#include <string>
+#include <vector>
 #include "CCSDSResult.h"
 #include <unordered_map>
 
@@ -39,4 +43,52 @@ CCSDS::ResultBool parseArguments(int argc, char *argv[],
  * @param logLevel
  */
 void customConsole(const std::string& appName, const std::string& message, const std::string& logLevel = "INFO");
+
+/**
+ * @brief Reads a binary file in chunks, memory use is bounded by the chunk size whatever the file size.
+ *
+ * @param filename path to the file to read.
+ * @param chunkSize size of the chunks in bytes.
+ * @param consumer called with every chunk in order, the chunk is overwritten by the next read. an error
+ * returned by the consumer stops the reading and is forwarded.
+ * @return CCSDS::ResultBool
+ */
+CCSDS::ResultBool readFileChunks(const std::string& filename, std::size_t chunkSize,
+                                 const std::function<CCSDS::ResultBool(const std::uint8_t*, std::size_t)>& consumer);
+
+/**
+ * @brief Binary file writer gathering small writes into blocks of the buffer size.
+ */
+class BufferedFileWriter {
+public:
+  /**
+   * @param bufferSize size of the write blocks in bytes (default 1 MiB).
+   */
+  explicit BufferedFileWriter(std::size_t bufferSize = 1 << 20) : m_buffer(bufferSize) {}
+  BufferedFileWriter(BufferedFileWriter&&) = default;
+  BufferedFileWriter& operator=(BufferedFileWriter&&) = default;
+
+  /** @brief flushes the buffered data, errors are lost, call close() to check them. */
+  ~BufferedFileWriter();
+
+  /** @brief creates or truncates the file. */
+  CCSDS::ResultBool open(const std::string& filename);
+
+  /** @brief appends data to the file, through the buffer. */
+  CCSDS::ResultBool write(const std::uint8_t* pData, std::size_t sizeData);
+
+  /** @brief writes the buffered data and closes the file. */
+  CCSDS::ResultBool close();
+
+  /** @brief returns the number of bytes written so far, buffered bytes included. */
+  [[nodiscard]] std::uint64_t getBytesWritten() const { return m_bytesWritten; }
+
+private:
+  CCSDS::ResultBool flush();
+
+  std::ofstream m_out;
+  std::vector<std::uint8_t> m_buffer;
+  std::size_t m_bufferUsed{0};
+  std::uint64_t m_bytesWritten{0};
+};
 #endif //EXEC_UTILS_H
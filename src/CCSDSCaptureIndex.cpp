@@ -0,0 +1,240 @@
+// Copyright 2025-2026 ExoSpaceLabs
+// SPDX-License-Identifier: Apache-2.0
+
+#include "CCSDSCaptureIndex.h"
+#include <algorithm>
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+#include "CCSDSHeader.h"
+#include "CCSDSStreamDecoder.h"
+
+namespace {
+  constexpr char kCaptureIndexMagic[8] = {'C', 'C', 'S', 'D', 'S', 'I', 'D', 'X'};
+  constexpr std::size_t kBatchSize = 4096; ///< packets decoded and written at once.
+  constexpr std::size_t kPusHeaderSize = 4; ///< version, service type, subtype and source ID.
+}
+
+CCSDS::ResultBool CCSDS::CaptureIndexBuilder::setTimeCodeSize(const std::uint8_t timeCodeSize) {
+  RET_IF_ERR_MSG(timeCodeSize > 8, ErrorCode::INVALID_DATA, "Cannot set time code size, exceeds 8 bytes");
+  m_timeCodeSize = timeCodeSize;
+  return true;
+}
+
+CCSDS::ResultBool CCSDS::CaptureIndexBuilder::build(const std::string &captureFile, const std::string &indexFile) {
+  MappedFile capture;
+  FORWARD_RESULT(capture.open(captureFile));
+  FORWARD_RESULT(build(capture.data(), capture.size(), indexFile));
+  return true;
+}
+
+CCSDS::ResultBool CCSDS::CaptureIndexBuilder::build(const std::uint8_t *pData, const std::size_t sizeData,
+                                                    const std::string &indexFile) {
+  RET_IF_ERR_MSG(!pData && sizeData != 0, ErrorCode::NULL_POINTER, "capture buffer is nullptr");
+  RET_IF_ERR_MSG(indexFile.empty(), ErrorCode::FILE_WRITE_ERROR, "No filename provided");
+  m_packetCount = 0;
+  m_skippedRegions = 0;
+  m_skippedBytes = 0;
+
+  std::ofstream out(indexFile, std::ios::binary | std::ios::trunc);
+  RET_IF_ERR_MSG(!out, ErrorCode::FILE_WRITE_ERROR, "Failed to open file for writing");
+
+  CaptureIndexHeader header{};
+  std::memcpy(header.magic, kCaptureIndexMagic, sizeof(header.magic));
+  header.version = kCaptureIndexVersion;
+  header.recordSize = sizeof(CaptureIndexRecord);
+  header.byteOrder = kCaptureIndexByteOrder;
+  header.captureSize = sizeData;
+  header.syncPattern = m_syncPattern;
+  header.syncPatternEnable = m_syncPattEnable ? 1 : 0;
+  header.pusEnable = m_pusEnable ? 1 : 0;
+  header.timeCodeSize = m_pusEnable ? m_timeCodeSize : 0;
+  // the record count is only known at the end, the header is rewritten once the records are in place.
+  out.write(reinterpret_cast<const char *>(&header), sizeof(header));
+
+  StreamDecoder decoder;
+  decoder.setSyncPattern(m_syncPattern);
+  decoder.setSyncPatternEnable(m_syncPattEnable);
+  decoder.setResyncEnable(m_resyncEnable);
+  decoder.push(pData, sizeData);
+
+  // the whole capture is pushed at once, so every view points into it.
+  std::vector<std::uint64_t> offsets;
+  offsets.reserve(kBatchSize);
+  const auto flush = [&] {
+    fillRecords(pData, offsets);
+    out.write(reinterpret_cast<const char *>(m_records.data()),
+              static_cast<std::streamsize>(m_records.size() * sizeof(CaptureIndexRecord)));
+    m_packetCount += offsets.size();
+    offsets.clear();
+  };
+
+  const auto failed = [&](const Error &error) {
+    out.close();
+    std::remove(indexFile.c_str());
+    return error;
+  };
+  PacketView view;
+  while (true) {
+    const auto res = decoder.next(view);
+    if (!res.has_value()) {
+      return failed(res.error());
+    }
+    if (!res.value()) {
+      break;
+    }
+    offsets.push_back(static_cast<std::uint64_t>(view.getBytes().data - pData));
+    if (offsets.size() == kBatchSize) {
+      flush();
+    }
+  }
+  flush();
+
+  if (m_resyncEnable && m_syncPattEnable) {
+    decoder.skipBuffered();
+  }
+  m_skippedRegions = decoder.getSkippedRegions();
+  m_skippedBytes = decoder.getSkippedBytes();
+  if (decoder.getBufferedBytes() != 0) {
+    return failed(Error{ErrorCode::INVALID_DATA, "Packet truncated, capture ends before the declared data length."});
+  }
+
+  header.recordCount = m_packetCount;
+  header.skippedBytes = m_skippedBytes;
+  out.seekp(0);
+  out.write(reinterpret_cast<const char *>(&header), sizeof(header));
+  out.flush();
+  if (!out) {
+    return failed(Error{ErrorCode::FILE_WRITE_ERROR, "Failed to write the data to the file"});
+  }
+  return true;
+}
+
+void CCSDS::CaptureIndexBuilder::fillRecords(const std::uint8_t *pData, const std::vector<std::uint64_t> &offsets) {
+  const std::size_t count = offsets.size();
+  m_records.resize(count);
+  m_identification.resize(count);
+  m_sequenceControl.resize(count);
+  m_dataLength.resize(count);
+  decodePrimaryHeaders(pData, offsets.data(), count, m_identification.data(), m_sequenceControl.data(),
+                       m_dataLength.data());
+
+  const std::size_t timeCodeEnd = kPusHeaderSize + m_timeCodeSize;
+  for (std::size_t row = 0; row < count; ++row) {
+    CaptureIndexRecord &record = m_records[row];
+    record = {};
+    record.offset = offsets[row];
+    record.identification = m_identification[row];
+    record.sequenceControl = m_sequenceControl[row];
+    record.dataLength = m_dataLength[row];
+    // the data length counts the data field bytes, the CRC excluded.
+    const bool secondaryHeader = (record.identification >> 11 & 0x1) != 0;
+    if (!m_pusEnable || !secondaryHeader || record.dataLength < kPusHeaderSize) {
+      continue;
+    }
+    const std::uint8_t *dataField = pData + record.offset + kPrimaryHeaderSize;
+    record.service = dataField[1];
+    record.subtype = dataField[2];
+    if (record.dataLength >= timeCodeEnd) {
+      for (std::size_t i = kPusHeaderSize; i < timeCodeEnd; ++i) {
+        record.timeCode = record.timeCode << 8 | dataField[i];
+      }
+    }
+  }
+}
+
+CCSDS::ResultBool CCSDS::CaptureIndexReader::open(const std::string &indexFile) {
+  close();
+  FORWARD_RESULT(m_index.open(indexFile, false));
+  CaptureIndexHeader header{};
+  if (m_index.size() < sizeof(header)) {
+    close();
+    return Error{ErrorCode::INVALID_DATA, "Invalid capture index, file is shorter than its header"};
+  }
+  std::memcpy(&header, m_index.data(), sizeof(header));
+  const char *failure = nullptr;
+  if (std::memcmp(header.magic, kCaptureIndexMagic, sizeof(header.magic)) != 0) {
+    failure = "Invalid capture index, magic does not match";
+  } else if (header.byteOrder != kCaptureIndexByteOrder) {
+    failure = "Invalid capture index, built on a host of another byte order";
+  } else if (header.version != kCaptureIndexVersion || header.recordSize != sizeof(CaptureIndexRecord)) {
+    failure = "Invalid capture index, unsupported version";
+  } else if (header.recordCount > (m_index.size() - sizeof(header)) / sizeof(CaptureIndexRecord) ||
+             m_index.size() != sizeof(header) + header.recordCount * sizeof(CaptureIndexRecord)) {
+    failure = "Invalid capture index, file size does not match the record count";
+  }
+  if (failure != nullptr) {
+    close();
+    return Error{ErrorCode::INVALID_DATA, failure};
+  }
+  m_header = header;
+  m_size = static_cast<std::size_t>(header.recordCount);
+  // the header keeps the records 8 bytes aligned within the page aligned mapping.
+  m_records = reinterpret_cast<const CaptureIndexRecord *>(m_index.data() + sizeof(header));
+  return true;
+}
+
+CCSDS::ResultBool CCSDS::CaptureIndexReader::openCapture(const std::string &captureFile) {
+  RET_IF_ERR_MSG(!m_index.isOpen(), ErrorCode::INVALID_DATA, "Cannot open capture, no index is open");
+  m_capture.close();
+  FORWARD_RESULT(m_capture.open(captureFile, false));
+  if (m_capture.size() != m_header.captureSize) {
+    m_capture.close();
+    return Error{ErrorCode::INVALID_DATA, "Capture does not match the index, sizes differ (stale index)"};
+  }
+  return true;
+}
+
+void CCSDS::CaptureIndexReader::close() {
+  m_capture.close();
+  m_index.close();
+  m_header = {};
+  m_records = nullptr;
+  m_size = 0;
+}
+
+CCSDS::Result<CCSDS::CaptureIndexRecord> CCSDS::CaptureIndexReader::getRecord(const std::size_t row) const {
+  if (row >= m_size) {
+    return Error{ErrorCode::INVALID_DATA, "Row exceeds the capture index"}.withIndex(row);
+  }
+  return m_records[row];
+}
+
+std::size_t CCSDS::CaptureIndexReader::countAPID(const std::uint16_t apid) const {
+  std::size_t count = 0;
+  for (std::size_t row = 0; row < m_size; ++row) {
+    count += (m_records[row].identification & 0x07FF) == apid;
+  }
+  return count;
+}
+
+std::vector<std::size_t> CCSDS::CaptureIndexReader::selectAPID(const std::uint16_t apid, const std::size_t first,
+                                                               const std::size_t last) const {
+  std::vector<std::size_t> rows;
+  for (std::size_t row = first; row < std::min(last, m_size); ++row) {
+    if ((m_records[row].identification & 0x07FF) == apid) {
+      rows.push_back(row);
+    }
+  }
+  return rows;
+}
+
+std::size_t CCSDS::CaptureIndexReader::lowerBoundTimeCode(const std::uint64_t timeCode) const {
+  const auto *record = std::lower_bound(begin(), end(), timeCode,
+                                        [](const CaptureIndexRecord &lhs, const std::uint64_t rhs) {
+                                          return lhs.timeCode < rhs;
+                                        });
+  return static_cast<std::size_t>(record - begin());
+}
+
+CCSDS::ResultBool CCSDS::CaptureIndexReader::getPacket(const std::size_t row, PacketView &view) const {
+  RET_IF_ERR_MSG(!m_capture.isOpen(), ErrorCode::INVALID_DATA, "Cannot get packet, no capture is open");
+  CaptureIndexRecord record{};
+  ASSIGN_CP(record, getRecord(row));
+  const std::size_t length = record.getFullPacketLength();
+  if (record.offset > m_capture.size() || length > m_capture.size() - record.offset) {
+    return Error{ErrorCode::INVALID_DATA, "Packet exceeds the capture"}.withIndex(row);
+  }
+  FORWARD_RESULT(view.deserialize(m_capture.data() + record.offset, length));
+  return true;
+}
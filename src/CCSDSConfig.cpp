@@ -17,11 +17,15 @@ CCSDS::ResultBool Config::load(const std::string &filename) {
   RET_IF_ERR_MSG(!file.is_open(),CCSDS::ErrorCode::CONFIG_FILE_ERROR, "Failed to open configuration file");
 
   std::string line;
+  std::uint32_t lineNumber{0};
   while (std::getline(file, line)) {
+    lineNumber++;
     if (line.empty() || line.front() == '#') continue;
 
     auto [key, type, valueStr] = parseLine(line);
-    RET_IF_ERR_MSG(key.empty() || type.empty(),CCSDS::ErrorCode::CONFIG_FILE_ERROR, "Failed to parse configuration file");
+    if (key.empty() || type.empty()) {
+      return CCSDS::Error{CCSDS::ErrorCode::CONFIG_FILE_ERROR, "Failed to parse configuration file line"}.withIndex(lineNumber);
+    }
     ConfigValue value;
     if (type == "string") {
       value = valueStr;
@@ -37,9 +41,13 @@ CCSDS::ResultBool Config::load(const std::string &filename) {
     } else if (type == "bool") {
       value = (valueStr == "true" || valueStr == "1");
     } else if (type == "bytes") {
-      ASSIGN_CP( value, parseBytes(valueStr) );
+      auto bytes = parseBytes(valueStr);
+      if (!bytes.has_value()) {
+        return bytes.error().withIndex(lineNumber);
+      }
+      value = std::move(bytes.value());
     } else {
-      return CCSDS::Error{CCSDS::ErrorCode::CONFIG_FILE_ERROR, " unknown type: " + type};
+      return CCSDS::Error{CCSDS::ErrorCode::CONFIG_FILE_ERROR, "Unknown type in configuration file line"}.withIndex(lineNumber);
     }
 
     values[key] = value;
@@ -118,8 +126,7 @@ CCSDS::ResultBuffer Config::parseBytes(const std::string &valueStr) {
 
     // Valid if parsed ok, consumed all characters, and fits in a byte
     if (res.ec != std::errc{} || res.ptr != last || tmp > 0xFFu) {
-      return CCSDS::Error{CCSDS::ErrorCode::CONFIG_FILE_ERROR,
-                          std::string("Invalid byte value: ") + std::string(token)};
+      return CCSDS::Error{CCSDS::ErrorCode::CONFIG_FILE_ERROR, "Invalid byte value in configuration file line"};
     }
     result.push_back(static_cast<uint8_t>(tmp));
   }
@@ -0,0 +1,310 @@
+// Copyright 2025-2026 ExoSpaceLabs
+// SPDX-License-Identifier: Apache-2.0
+
+#include "CCSDSCrc.h"
+#include <algorithm>
+#include <deque>
+
+//exclude includes when building for MCU
+#ifndef CCSDS_MCU
+  #include <atomic>
+  #include <mutex>
+
+  // carry-less multiply folding kernels, x86-64 selects it at runtime, ARMv8 when built with crypto extensions.
+  #if (defined(__GNUC__) || defined(__clang__)) && defined(__x86_64__)
+    #define CCSDS_CRC_CLMUL_X86 1
+    #include <immintrin.h>
+  #elif defined(__aarch64__) && (defined(__ARM_FEATURE_CRYPTO) || defined(__ARM_FEATURE_AES))
+    #define CCSDS_CRC_CLMUL_ARM 1
+    #include <arm_neon.h>
+  #endif
+#endif //CCSDS_MCU
+
+namespace {
+  constexpr std::size_t kCachedEngines = 8;  ///< polynomials looked up without taking the lock.
+  constexpr std::size_t kSliceThreshold = 16;
+  constexpr std::size_t kFoldThreshold = 256;
+
+  /** @brief computes x^n mod P, P being the polynomial with its implicit x^16 term. */
+  std::uint16_t xPowMod(const std::uint32_t n, const std::uint16_t polynomial) {
+    std::uint32_t remainder = 1;
+    for (std::uint32_t i = 0; i < n; ++i) {
+      remainder <<= 1;
+      if (remainder & 0x10000) {
+        remainder ^= 0x10000 | polynomial;
+      }
+    }
+    return static_cast<std::uint16_t>(remainder);
+  }
+
+  /** @brief multiplies a and b modulo P, P being the polynomial with its implicit x^16 term. */
+  std::uint16_t mulMod(const std::uint16_t a, const std::uint16_t b, const std::uint16_t polynomial) {
+    std::uint32_t product = 0;
+    for (std::int32_t i = 15; i >= 0; --i) {
+      product <<= 1;
+      if (product & 0x10000) {
+        product ^= 0x10000 | polynomial;
+      }
+      if ((b >> i) & 1) {
+        product ^= a;
+      }
+    }
+    return static_cast<std::uint16_t>(product);
+  }
+
+#ifdef CCSDS_CRC_CLMUL_X86
+  bool clmulSupported() {
+    static const bool supported = [] {
+      __builtin_cpu_init();
+      return __builtin_cpu_supports("pclmul") && __builtin_cpu_supports("ssse3");
+    }();
+    return supported;
+  }
+
+  __attribute__((target("pclmul,ssse3")))
+  inline __m128i loadReversed(const std::uint8_t *pData) {
+    const __m128i reverse = _mm_set_epi8(0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15);
+    return _mm_shuffle_epi8(_mm_loadu_si128(reinterpret_cast<const __m128i *>(pData)), reverse);
+  }
+
+  /** @brief multiplies the high and low halves of acc by their x^n mod P constants, reducing it by n bits. */
+  __attribute__((target("pclmul,ssse3")))
+  inline __m128i fold(const __m128i acc, const __m128i constants) {
+    return _mm_xor_si128(_mm_clmulepi64_si128(acc, constants, 0x11), _mm_clmulepi64_si128(acc, constants, 0x00));
+  }
+
+  /**
+   * @brief Folds size bytes (multiple of 16, at least 64) into a 16 byte remainder congruent to the input.
+   *
+   * The CRC register is xored into the first two bytes, so the CRC of the remainder computed with a
+   * zero initial register equals the CRC of the input.
+   */
+  __attribute__((target("pclmul,ssse3")))
+  void foldBlocks(const std::uint8_t *pData, const std::size_t size, const std::uint16_t crc,
+                  const std::uint64_t *k, std::uint8_t *remainder) {
+    const std::uint8_t *end = pData + size;
+    const __m128i k128 = _mm_set_epi64x(static_cast<long long>(k[1]), static_cast<long long>(k[0]));
+    const __m128i k256 = _mm_set_epi64x(static_cast<long long>(k[3]), static_cast<long long>(k[2]));
+    const __m128i k384 = _mm_set_epi64x(static_cast<long long>(k[5]), static_cast<long long>(k[4]));
+    const __m128i k512 = _mm_set_epi64x(static_cast<long long>(k[7]), static_cast<long long>(k[6]));
+
+    __m128i a0 = _mm_xor_si128(loadReversed(pData), _mm_set_epi64x(static_cast<long long>(crc) << 48, 0));
+    __m128i a1 = loadReversed(pData + 16);
+    __m128i a2 = loadReversed(pData + 32);
+    __m128i a3 = loadReversed(pData + 48);
+    pData += 64;
+    while (end - pData >= 64) {
+      a0 = _mm_xor_si128(fold(a0, k512), loadReversed(pData));
+      a1 = _mm_xor_si128(fold(a1, k512), loadReversed(pData + 16));
+      a2 = _mm_xor_si128(fold(a2, k512), loadReversed(pData + 32));
+      a3 = _mm_xor_si128(fold(a3, k512), loadReversed(pData + 48));
+      pData += 64;
+    }
+    a0 = _mm_xor_si128(_mm_xor_si128(fold(a0, k384), fold(a1, k256)), _mm_xor_si128(fold(a2, k128), a3));
+    while (end - pData >= 16) {
+      a0 = _mm_xor_si128(fold(a0, k128), loadReversed(pData));
+      pData += 16;
+    }
+    const __m128i reverse = _mm_set_epi8(0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15);
+    _mm_storeu_si128(reinterpret_cast<__m128i *>(remainder), _mm_shuffle_epi8(a0, reverse));
+  }
+#endif
+
+#ifdef CCSDS_CRC_CLMUL_ARM
+  bool clmulSupported() { return true; }
+
+  inline uint8x16_t loadReversed(const std::uint8_t *pData) {
+    const uint8x16_t bytes = vrev64q_u8(vld1q_u8(pData));
+    return vextq_u8(bytes, bytes, 8);
+  }
+
+  /** @brief multiplies the high and low halves of acc by their x^n mod P constants, reducing it by n bits. */
+  inline uint8x16_t fold(const uint8x16_t acc, const std::uint64_t kHigh, const std::uint64_t kLow) {
+    const uint64x2_t halves = vreinterpretq_u64_u8(acc);
+    const poly128_t high = vmull_p64(static_cast<poly64_t>(vgetq_lane_u64(halves, 1)), static_cast<poly64_t>(kHigh));
+    const poly128_t low = vmull_p64(static_cast<poly64_t>(vgetq_lane_u64(halves, 0)), static_cast<poly64_t>(kLow));
+    return veorq_u8(vreinterpretq_u8_p128(high), vreinterpretq_u8_p128(low));
+  }
+
+  /** @brief see the x86 variant, same layout using PMULL. */
+  void foldBlocks(const std::uint8_t *pData, const std::size_t size, const std::uint16_t crc,
+                  const std::uint64_t *k, std::uint8_t *remainder) {
+    const std::uint8_t *end = pData + size;
+    const uint8x16_t seed = vreinterpretq_u8_u64(vcombine_u64(vcreate_u64(0),
+                                                              vcreate_u64(static_cast<std::uint64_t>(crc) << 48)));
+    uint8x16_t a0 = veorq_u8(loadReversed(pData), seed);
+    uint8x16_t a1 = loadReversed(pData + 16);
+    uint8x16_t a2 = loadReversed(pData + 32);
+    uint8x16_t a3 = loadReversed(pData + 48);
+    pData += 64;
+    while (end - pData >= 64) {
+      a0 = veorq_u8(fold(a0, k[7], k[6]), loadReversed(pData));
+      a1 = veorq_u8(fold(a1, k[7], k[6]), loadReversed(pData + 16));
+      a2 = veorq_u8(fold(a2, k[7], k[6]), loadReversed(pData + 32));
+      a3 = veorq_u8(fold(a3, k[7], k[6]), loadReversed(pData + 48));
+      pData += 64;
+    }
+    a0 = veorq_u8(veorq_u8(fold(a0, k[5], k[4]), fold(a1, k[3], k[2])), veorq_u8(fold(a2, k[1], k[0]), a3));
+    while (end - pData >= 16) {
+      a0 = veorq_u8(fold(a0, k[1], k[0]), loadReversed(pData));
+      pData += 16;
+    }
+    const uint8x16_t bytes = vrev64q_u8(a0);
+    vst1q_u8(remainder, vextq_u8(bytes, bytes, 8));
+  }
+#endif
+}
+
+CCSDS::CRC16Engine::CRC16Engine(const std::uint16_t polynomial) : m_polynomial(polynomial) {
+  for (std::uint32_t byte = 0; byte < 256; ++byte) {
+    auto crc = static_cast<std::uint16_t>(byte << 8);
+    for (std::int32_t i = 0; i < 8; ++i) {
+      crc = (crc & 0x8000) ? static_cast<std::uint16_t>((crc << 1) ^ polynomial) : static_cast<std::uint16_t>(crc << 1);
+    }
+    m_table[0][byte] = crc;
+  }
+  for (std::size_t k = 1; k < kSlices; ++k) {
+    for (std::size_t byte = 0; byte < 256; ++byte) {
+      const std::uint16_t previous = m_table[k - 1][byte];
+      m_table[k][byte] = static_cast<std::uint16_t>((previous << 8) ^ m_table[0][previous >> 8]);
+    }
+  }
+  for (std::uint32_t i = 0; i < 8; ++i) {
+    m_foldConstants[i] = xPowMod(128 + 64 * i, polynomial);
+  }
+  m_shiftPowers[0] = xPowMod(8, polynomial);
+  for (std::size_t i = 1; i < 64; ++i) {
+    m_shiftPowers[i] = mulMod(m_shiftPowers[i - 1], m_shiftPowers[i - 1], polynomial);
+  }
+}
+
+std::uint16_t CCSDS::CRC16Engine::shift(std::uint16_t crc, std::size_t zeroBytes) const {
+  for (std::size_t i = 0; zeroBytes != 0 && crc != 0; ++i, zeroBytes >>= 1) {
+    if (zeroBytes & 1) {
+      crc = mulMod(crc, m_shiftPowers[i], m_polynomial);
+    }
+  }
+  return crc;
+}
+
+CCSDS::CRC16State::CRC16State(const CRC16Config &config) : m_engine(&CRC16Engine::get(config.polynomial)),
+                                                           m_config(config), m_register(config.initialValue) {
+}
+
+void CCSDS::CRC16State::reset() {
+  m_register = m_config.initialValue;
+  m_size = 0;
+}
+
+void CCSDS::CRC16State::append(const std::uint8_t *pData, const std::size_t sizeData) {
+  m_register = m_engine->compute(pData, sizeData, m_register);
+  m_size += sizeData;
+}
+
+void CCSDS::CRC16State::append(const CRC16State &segment) {
+  // the segment register is its zero-initialized CRC plus the initial value advanced over the segment.
+  m_register = static_cast<std::uint16_t>(m_engine->shift(m_register ^ m_config.initialValue, segment.m_size) ^
+                                          segment.m_register);
+  m_size += segment.m_size;
+}
+
+bool CCSDS::CRC16State::patch(const std::size_t offset, const std::uint8_t *pOld, const std::uint8_t *pNew,
+                              const std::size_t sizeData) {
+  if (offset > m_size || sizeData > m_size - offset) {
+    return false;
+  }
+  // the CRC is linear: the change is the zero-initialized CRC of old ^ new advanced to the end of the sequence.
+  std::uint8_t delta[64];
+  std::uint16_t crc = 0;
+  for (std::size_t done = 0; done < sizeData;) {
+    const std::size_t chunk = std::min(sizeData - done, sizeof(delta));
+    for (std::size_t i = 0; i < chunk; ++i) {
+      delta[i] = pOld[done + i] ^ pNew[done + i];
+    }
+    crc = m_engine->compute(delta, chunk, crc);
+    done += chunk;
+  }
+  m_register ^= m_engine->shift(crc, m_size - offset - sizeData);
+  return true;
+}
+
+const CCSDS::CRC16Engine &CCSDS::CRC16Engine::get(const std::uint16_t polynomial) {
+  static std::deque<CRC16Engine> storage; // deque keeps engine addresses stable while growing.
+#ifndef CCSDS_MCU
+  static std::atomic<const CRC16Engine *> cache[kCachedEngines]{};
+  static std::mutex mutex;
+
+  for (auto &slot: cache) {
+    const CRC16Engine *engine = slot.load(std::memory_order_acquire);
+    if (engine == nullptr) {
+      break;
+    }
+    if (engine->m_polynomial == polynomial) {
+      return *engine;
+    }
+  }
+
+  std::lock_guard<std::mutex> lock(mutex);
+  for (const auto &engine: storage) {
+    if (engine.m_polynomial == polynomial) {
+      return engine;
+    }
+  }
+  const CRC16Engine &engine = storage.emplace_back(polynomial);
+  if (storage.size() <= kCachedEngines) {
+    cache[storage.size() - 1].store(&engine, std::memory_order_release);
+  }
+  return engine;
+#else
+  for (const auto &engine: storage) {
+    if (engine.m_polynomial == polynomial) {
+      return engine;
+    }
+  }
+  return storage.emplace_back(polynomial);
+#endif
+}
+
+std::uint16_t CCSDS::CRC16Engine::compute(const std::uint8_t *pData, std::size_t sizeData,
+                                          std::uint16_t initialValue) const {
+  if (pData == nullptr || sizeData == 0) {
+    return initialValue;
+  }
+#if defined(CCSDS_CRC_CLMUL_X86) || defined(CCSDS_CRC_CLMUL_ARM)
+  if (sizeData >= kFoldThreshold && clmulSupported()) {
+    const std::size_t foldedSize = sizeData & ~static_cast<std::size_t>(15);
+    std::uint8_t remainder[16];
+    foldBlocks(pData, foldedSize, initialValue, m_foldConstants, remainder);
+    const std::uint16_t crc = computeSliced(remainder, sizeof(remainder), 0);
+    return computeBytewise(pData + foldedSize, sizeData - foldedSize, crc);
+  }
+#endif
+  if (kSlices == 8 && sizeData >= kSliceThreshold) {
+    return computeSliced(pData, sizeData, initialValue);
+  }
+  return computeBytewise(pData, sizeData, initialValue);
+}
+
+std::uint16_t CCSDS::CRC16Engine::computeBytewise(const std::uint8_t *pData, const std::size_t sizeData,
+                                                  std::uint16_t crc) const {
+  for (std::size_t i = 0; i < sizeData; ++i) {
+    crc = static_cast<std::uint16_t>((crc << 8) ^ m_table[0][(crc >> 8) ^ pData[i]]);
+  }
+  return crc;
+}
+
+std::uint16_t CCSDS::CRC16Engine::computeSliced(const std::uint8_t *pData, std::size_t sizeData,
+                                                std::uint16_t crc) const {
+#ifndef CCSDS_MCU
+  // the register only overlaps the first two bytes of each 8 byte block, the others go straight to their table.
+  while (sizeData >= 8) {
+    crc = static_cast<std::uint16_t>(m_table[7][pData[0] ^ (crc >> 8)] ^ m_table[6][pData[1] ^ (crc & 0xFF)] ^
+                                     m_table[5][pData[2]] ^ m_table[4][pData[3]] ^
+                                     m_table[3][pData[4]] ^ m_table[2][pData[5]] ^
+                                     m_table[1][pData[6]] ^ m_table[0][pData[7]]);
+    pData += 8;
+    sizeData -= 8;
+  }
+#endif
+  return computeBytewise(pData, sizeData, crc);
+}
@@ -4,6 +4,7 @@
 #include "CCSDSDataField.h"
 #include <CCSDSSecondaryHeaderFactory.h>
 
+#include <algorithm>
 #include <utility>
 
 std::vector<std::uint8_t> CCSDS::DataField::serialize() {
@@ -17,6 +18,16 @@ std::vector<std::uint8_t> CCSDS::DataField::serialize() {
   return fullData;
 }
 
+std::size_t CCSDS::DataField::serializeInto(std::uint8_t *pData) {
+  update();
+  std::size_t offset = 0;
+  if (m_secondaryHeader) {
+    offset = m_secondaryHeader->serializeInto(pData);
+  }
+  std::copy(m_applicationData.begin(), m_applicationData.end(), pData + offset);
+  return offset + m_applicationData.size();
+}
+
 std::vector<std::uint8_t> CCSDS::DataField::getApplicationData() {
   return m_applicationData;
 }
@@ -38,7 +49,7 @@ uint16_t CCSDS::DataField::getDataFieldUsedBytesSize() const {
   if (!getDataFieldHeaderFlag()) {
     return m_applicationData.size();
   }
-  if (m_secondaryHeader != nullptr) {
+  if (m_secondaryHeader) {
     return m_applicationData.size() + m_secondaryHeader->getSize();
   }
   return 0;
@@ -46,12 +57,12 @@ uint16_t CCSDS::DataField::getDataFieldUsedBytesSize() const {
 
 std::shared_ptr<CCSDS::SecondaryHeaderAbstract> CCSDS::DataField::getSecondaryHeader() {
   update();
-  return m_secondaryHeader;
+  return m_secondaryHeader.share();
 }
 
 void CCSDS::DataField::update() {
   if (!m_dataFieldHeaderUpdated && m_enableDataFieldUpdate) {
-    if (m_secondaryHeaderFactory.typeIsRegistered(m_dataFieldHeaderType)) {
+    if (getDataFieldHeaderFactory().typeIsRegistered(m_dataFieldHeaderTypeId)) {
       m_secondaryHeader->update(this);
     }
     m_dataFieldHeaderUpdated = true;
@@ -72,6 +83,35 @@ CCSDS::ResultBool CCSDS::DataField::setApplicationData(const std::uint8_t *pData
   return true;
 }
 
+CCSDS::ResultBool CCSDS::DataField::appendApplicationData(const std::uint8_t *pData, const size_t &sizeData) {
+  RET_IF_ERR_MSG(!pData, ErrorCode::NULL_POINTER, "Application data is nullptr");
+  RET_IF_ERR_MSG(sizeData > getDataFieldAvailableBytesSize(), ErrorCode::INVALID_APPLICATION_DATA,
+                 "Application data field exceeds available size");
+  m_applicationData.insert(m_applicationData.end(), pData, pData + sizeData);
+  m_dataFieldHeaderUpdated = false;
+  return true;
+}
+
+CCSDS::ResultBool CCSDS::DataField::patchApplicationData(const size_t &offset, const std::uint8_t *pData,
+                                                         const size_t &sizeData) {
+  RET_IF_ERR_MSG(!pData, ErrorCode::NULL_POINTER, "Application data is nullptr");
+  RET_IF_ERR_MSG(offset > m_applicationData.size() || sizeData > m_applicationData.size() - offset,
+                 ErrorCode::INVALID_APPLICATION_DATA, "Application data patch exceeds the application data");
+  std::copy(pData, pData + sizeData, m_applicationData.begin() + static_cast<std::ptrdiff_t>(offset));
+  m_dataFieldHeaderUpdated = false;
+  return true;
+}
+
+void CCSDS::DataField::clear() {
+  m_secondaryHeader.reset(nullptr);
+  m_applicationData.clear();
+  m_dataFieldHeaderType.clear();
+  m_dataFieldHeaderTypeId = INVALID_TYPE_ID;
+  m_dataPacketSize = 2024;
+  m_dataFieldHeaderUpdated = false;
+  m_enableDataFieldUpdate = true;
+}
+
 CCSDS::ResultBool CCSDS::DataField::setApplicationData(const std::vector<std::uint8_t> &applicationData) {
   RET_IF_ERR_MSG(applicationData.size() > getDataFieldAvailableBytesSize(), ErrorCode::INVALID_APPLICATION_DATA,
                  "Application data field exceeds available size.");
@@ -96,10 +136,10 @@ CCSDS::ResultBool CCSDS::DataField::setDataFieldHeader(const std::uint8_t *pData
                                                        const std::string &pType) {
   RET_IF_ERR_MSG(!pData, ErrorCode::NULL_POINTER, "Secondary header data is nullptr");
 
-  RET_IF_ERR_MSG(!m_secondaryHeaderFactory.typeIsRegistered(pType), ErrorCode::INVALID_SECONDARY_HEADER_DATA,
-                 "Secondary header type is not registered: " + pType);
+  RET_IF_ERR_MSG(!getDataFieldHeaderFactory().typeIsRegistered(pType), ErrorCode::INVALID_SECONDARY_HEADER_DATA,
+                 "Secondary header type is not registered");
 
-  if (m_secondaryHeaderFactory.typeIsRegistered(pType)) {
+  if (getDataFieldHeaderFactory().typeIsRegistered(pType)) {
     std::vector<std::uint8_t> data;
     data.assign(pData, pData + sizeData);
     FORWARD_RESULT(setDataFieldHeader(data,pType));
@@ -115,21 +155,43 @@ CCSDS::ResultBool CCSDS::DataField::setDataFieldHeader(const std::vector<std::ui
                                                        const std::string &pType) {
   RET_IF_ERR_MSG(data.size() > getDataFieldAvailableBytesSize(), ErrorCode::INVALID_SECONDARY_HEADER_DATA,
                  "Secondary header data exceeds available size");
-  RET_IF_ERR_MSG(!m_secondaryHeaderFactory.typeIsRegistered(pType), ErrorCode::INVALID_SECONDARY_HEADER_DATA,
-                   "Secondary header type is not registered: " + pType);
+  const auto typeId = getDataFieldHeaderFactory().getTypeId(pType);
+  RET_IF_ERR_MSG(!getDataFieldHeaderFactory().typeIsRegistered(typeId), ErrorCode::INVALID_SECONDARY_HEADER_DATA,
+                   "Secondary header type is not registered");
 
-  auto header = m_secondaryHeaderFactory.create(pType);
+  FORWARD_RESULT(setDataFieldHeader(data.data(), data.size(), typeId));
+  return true;
+}
 
-  if (!header->variableLength) {
-    RET_IF_ERR_MSG(data.size() != header->getSize(), ErrorCode::INVALID_SECONDARY_HEADER_DATA,
-                     "Secondary header data size mismatch for type: " + pType);
+CCSDS::ResultBool CCSDS::DataField::setDataFieldHeader(const std::uint8_t *pData, const size_t &sizeData,
+                                                       const SecondaryHeaderTypeId typeId) {
+  RET_IF_ERR_MSG(!pData, ErrorCode::NULL_POINTER, "Secondary header data is nullptr");
+  RET_IF_ERR_MSG(!getDataFieldHeaderFactory().typeIsRegistered(typeId), ErrorCode::INVALID_SECONDARY_HEADER_DATA,
+                 "Secondary header type id is not registered");
+  if (!getDataFieldHeaderFactory().isVariableLength(typeId)) {
+    if (const auto expectedSize = getDataFieldHeaderFactory().getSize(typeId); sizeData != expectedSize) {
+      return Error{ErrorCode::INVALID_SECONDARY_HEADER_DATA, "Secondary header data size mismatch for its type"}
+          .withValues(expectedSize, sizeData);
+    }
   }
 
-  m_secondaryHeader = std::move(header);
-  FORWARD_RESULT(m_secondaryHeader->deserialize(data));
-
-  m_dataFieldHeaderType = pType;
+  // the built-in fixed size headers are deserialized on the stack and copied into the inline storage.
+  if (typeId == PUSA_TYPE_ID) {
+    PusA header;
+    FORWARD_RESULT(header.deserialize(pData, sizeData));
+    m_secondaryHeader.emplace(header);
+  } else if (typeId == PUSB_TYPE_ID) {
+    PusB header;
+    FORWARD_RESULT(header.deserialize(pData, sizeData));
+    m_secondaryHeader.emplace(header);
+  } else {
+    auto header = getDataFieldHeaderFactory().create(typeId);
+    FORWARD_RESULT(header->deserialize(pData, sizeData));
+    m_secondaryHeader.reset(std::move(header));
+  }
 
+  m_dataFieldHeaderType = m_secondaryHeader->getType();
+  m_dataFieldHeaderTypeId = typeId;
   m_dataFieldHeaderUpdated = false;
   return true;
 }
@@ -138,11 +200,10 @@ CCSDS::ResultBool CCSDS::DataField::setDataFieldHeader(const std::vector<std::ui
   RET_IF_ERR_MSG(dataFieldHeader.size() > getDataFieldAvailableBytesSize(), ErrorCode::INVALID_SECONDARY_HEADER_DATA,
                  "Secondary header data exceeds available size");
 
-  BufferHeader header;
-  m_secondaryHeader = std::make_shared<BufferHeader>(dataFieldHeader);
-  FORWARD_RESULT(  m_secondaryHeader->deserialize(dataFieldHeader) );
+  m_secondaryHeader.reset(std::make_shared<BufferHeader>(dataFieldHeader));
 
-  m_dataFieldHeaderType = m_secondaryHeader->getType(); ;
+  m_dataFieldHeaderType = m_secondaryHeader->getType();
+  m_dataFieldHeaderTypeId = BUFFER_HEADER_TYPE_ID;
   m_dataFieldHeaderUpdated = false;
   return true;
 }
@@ -152,23 +213,48 @@ CCSDS::ResultBool CCSDS::DataField::setDataFieldHeader(const Config& cfg) {
   RET_IF_ERR_MSG(!cfg.isKey("secondary_header_type"), ErrorCode::CONFIG_FILE_ERROR,
                      "Config: Missing string field: secondary_header_type");
   std::string type{};
-  ASSIGN_OR_PRINT(type, cfg.get<std::string>("secondary_header_type"));
-  RET_IF_ERR_MSG(!m_secondaryHeaderFactory.typeIsRegistered(type), ErrorCode::INVALID_SECONDARY_HEADER_DATA,
-                   "Secondary header type is not registered: " + type);
+  ASSIGN_CONFIG_OR_PRINT(type, cfg, std::string, "secondary_header_type");
+  const auto typeId = getDataFieldHeaderFactory().getTypeId(type);
+  RET_IF_ERR_MSG(!getDataFieldHeaderFactory().typeIsRegistered(typeId), ErrorCode::INVALID_SECONDARY_HEADER_DATA,
+                   "Secondary header type is not registered");
 
-  m_secondaryHeader = m_secondaryHeaderFactory.create(type);
+  m_secondaryHeader.reset(getDataFieldHeaderFactory().create(typeId));
   RET_IF_ERR_MSG(!m_secondaryHeader, ErrorCode::INVALID_SECONDARY_HEADER_DATA,
-                   "Failed to create secondary header of type: " + type);
+                   "Failed to create secondary header");
   m_secondaryHeader->loadFromConfig(cfg);
   m_dataFieldHeaderType = m_secondaryHeader->getType();
+  m_dataFieldHeaderTypeId = typeId;
   return true;
 }
 #endif
 
 void CCSDS::DataField::setDataFieldHeader(std::shared_ptr<SecondaryHeaderAbstract> header) {
-  m_secondaryHeader = std::move(header);
+  m_secondaryHeader.reset(std::move(header));
   m_dataFieldHeaderType = m_secondaryHeader->getType();
+  m_dataFieldHeaderTypeId = getDataFieldHeaderFactory().getTypeId(m_dataFieldHeaderType);
+  m_dataFieldHeaderUpdated = false;
+}
+
+bool CCSDS::DataField::detachSecondaryHeader() {
+  if (!m_secondaryHeader || m_secondaryHeader.isInline()) {
+    return true; // inline headers are copied with the data field, never shared.
+  }
+  // fixed size PUS headers are moved inline by a byte round trip, which needs no knowledge of the concrete class.
+  if ((m_dataFieldHeaderTypeId == PUSA_TYPE_ID && m_secondaryHeader->getSize() == PusA::kSize) ||
+      (m_dataFieldHeaderTypeId == PUSB_TYPE_ID && m_secondaryHeader->getSize() == PusB::kSize)) {
+    std::uint8_t buffer[PusB::kSize];
+    const auto size = m_secondaryHeader->serializeInto(buffer);
+    if (setDataFieldHeader(buffer, size, m_dataFieldHeaderTypeId).has_value()) {
+      return true;
+    }
+  }
+  auto header = m_secondaryHeader->clone();
+  if (!header) {
+    return false;
+  }
+  m_secondaryHeader.reset(std::move(header));
   m_dataFieldHeaderUpdated = false;
+  return true;
 }
 
 void CCSDS::DataField::setDataPacketSize(const std::uint16_t &value) { m_dataPacketSize = value; }
@@ -181,4 +267,13 @@ std::vector<std::uint8_t> CCSDS::DataField::getDataFieldHeaderBytes() {
   return {};
 }
 
+std::uint16_t CCSDS::DataField::getDataFieldHeaderBytesSize() const {
+  return m_secondaryHeader ? m_secondaryHeader->getSize() : 0;
+}
+
+std::uint16_t CCSDS::DataField::serializeDataFieldHeaderInto(std::uint8_t *pData) {
+  update();
+  return m_secondaryHeader ? m_secondaryHeader->serializeInto(pData) : 0;
+}
+
 
@@ -0,0 +1,124 @@
+// Copyright 2025-2026 ExoSpaceLabs
+// SPDX-License-Identifier: Apache-2.0
+
+#include "CCSDSDemultiplexer.h"
+
+CCSDS::Demultiplexer::Demultiplexer() {
+  m_channelIndex.fill(kNoChannel);
+  m_reassembler.setSink([this](const std::uint16_t apid, const std::uint8_t *pData, const std::size_t sizeData) {
+    m_channels[m_channelIndex[apid]].sink(apid, pData, sizeData);
+  });
+}
+
+CCSDS::ResultBool CCSDS::Demultiplexer::addChannel(const Packet &templatePacket, Sink sink) {
+  Packet channelTemplate = templatePacket;
+  channelTemplate.setUpdatePacketEnable(false);
+  const auto apid = channelTemplate.getPrimaryHeader().getAPID();
+  const auto secondaryHeaderSize = channelTemplate.getDataField().getDataFieldHeaderBytesSize();
+  FORWARD_RESULT(createChannel(apid, std::move(sink), secondaryHeaderSize, &channelTemplate));
+  return true;
+}
+
+CCSDS::ResultBool CCSDS::Demultiplexer::addChannel(const std::uint16_t apid, Sink sink,
+                                                   const std::uint16_t secondaryHeaderSize) {
+  FORWARD_RESULT(createChannel(apid, std::move(sink), secondaryHeaderSize, nullptr));
+  return true;
+}
+
+CCSDS::ResultBool CCSDS::Demultiplexer::createChannel(const std::uint16_t apid, Sink sink,
+                                                      const std::uint16_t secondaryHeaderSize,
+                                                      const Packet *templatePacket) {
+  if (apid >= kApidCount || m_channelIndex[apid] != kNoChannel) {
+    return Error{ErrorCode::INVALID_DATA, apid >= kApidCount ? "Cannot add channel, APID exceeds 11 bits"
+                                                             : "Cannot add channel, APID already has a channel"}
+        .withApid(apid);
+  }
+  RET_IF_ERR_MSG(!sink, ErrorCode::NULL_POINTER, "Cannot add channel, sink is empty");
+
+  Channel channel;
+  channel.apid = apid;
+  channel.secondaryHeaderSize = secondaryHeaderSize;
+  channel.sink = std::move(sink);
+  // sequence continuity is checked per sequence by the reassembly, not against the validator counter.
+  if (templatePacket != nullptr) {
+    channel.validator.setTemplatePacket(*templatePacket);
+    channel.validator.configure(true, false, true);
+  } else {
+    channel.validator.configure(true, false, false);
+  }
+  m_channelIndex[apid] = static_cast<std::uint16_t>(m_channels.size());
+  m_channels.push_back(std::move(channel));
+  return true;
+}
+
+std::vector<std::uint16_t> CCSDS::Demultiplexer::getChannels() const {
+  std::vector<std::uint16_t> apids;
+  apids.reserve(m_channels.size());
+  for (const auto &channel : m_channels) {
+    apids.push_back(channel.apid);
+  }
+  return apids;
+}
+
+CCSDS::Result<CCSDS::DemuxChannelStatistics> CCSDS::Demultiplexer::getChannelStatistics(const std::uint16_t apid) const {
+  if (!hasChannel(apid)) {
+    return Error{ErrorCode::INVALID_DATA, "APID has no channel"}.withApid(apid);
+  }
+  DemuxChannelStatistics statistics = m_channels[m_channelIndex[apid]].statistics;
+  statistics.reassembly = m_reassembler.getStatistics(apid);
+  return statistics;
+}
+
+CCSDS::ResultBool CCSDS::Demultiplexer::push(const std::uint8_t *pData, const std::size_t sizeData) {
+  RET_IF_ERR_MSG(!pData, ErrorCode::NULL_POINTER, "packet buffer is nullptr");
+  m_decoder.push(pData, sizeData);
+  PacketView view;
+  bool packetFound{false};
+  ASSIGN_CP(packetFound, m_decoder.next(view));
+  while (packetFound) {
+    FORWARD_RESULT(route(view));
+    ASSIGN_CP(packetFound, m_decoder.next(view));
+  }
+  return true;
+}
+
+CCSDS::ResultBool CCSDS::Demultiplexer::decode(const std::uint8_t *pData, const std::size_t sizeData) {
+  FORWARD_RESULT(push(pData, sizeData));
+  FORWARD_RESULT(finish());
+  return true;
+}
+
+CCSDS::ResultBool CCSDS::Demultiplexer::finish() {
+  m_reassembler.flush();
+  if (m_decoder.getResyncEnable() && m_decoder.getSyncPatternEnable()) {
+    m_decoder.skipBuffered();
+  }
+  const bool truncated = m_decoder.getBufferedBytes() != 0;
+  m_decoder.skipBuffered(); // leaves the decoder ready for a new stream.
+  RET_IF_ERR_MSG(truncated, ErrorCode::INVALID_DATA, "Packet truncated, stream ends before the declared data length.");
+  return true;
+}
+
+CCSDS::ResultBool CCSDS::Demultiplexer::route(const PacketView &view) {
+  const std::uint16_t apid = view.getAPID();
+  if (m_channelIndex[apid] == kNoChannel) {
+    if (!m_defaultSink) {
+      m_unroutedPackets++;
+      return true;
+    }
+    FORWARD_RESULT(createChannel(apid, m_defaultSink, 0, nullptr));
+  }
+  Channel &channel = m_channels[m_channelIndex[apid]];
+  channel.statistics.packets++;
+
+  PacketView packet;
+  if (!packet.deserialize(view.getBytes().data, view.getBytes().size, channel.secondaryHeaderSize).has_value() ||
+      (m_validateEnable && !channel.validator.validate(packet))) {
+    channel.statistics.invalidPackets++;
+    m_reassembler.drop(apid);
+    return true;
+  }
+
+  FORWARD_RESULT(m_reassembler.add(packet, ++m_routedPackets));
+  return true;
+}
@@ -4,14 +4,110 @@
 #include "CCSDSHeader.h"
 #include "CCSDSUtils.h"
 
+//exclude includes when building for MCU
+#ifndef CCSDS_MCU
+  // vectorized batch decoding, SSE2 is part of x86-64 and NEON of aarch64, no runtime selection is needed.
+  #if (defined(__GNUC__) || defined(__clang__)) && defined(__x86_64__)
+    #define CCSDS_HEADER_DECODE_X86 1
+    #include <immintrin.h>
+  #elif (defined(__GNUC__) || defined(__clang__)) && defined(__aarch64__)
+    #define CCSDS_HEADER_DECODE_NEON 1
+    #include <arm_neon.h>
+  #endif
+#endif //CCSDS_MCU
+
+namespace {
+  /** @brief reads the big endian 16 bit word at pData. */
+  std::uint16_t readWord(const std::uint8_t *pData) {
+    return static_cast<std::uint16_t>(pData[0] << 8 | pData[1]);
+  }
+
+#ifdef CCSDS_HEADER_DECODE_X86
+  /**
+   * @brief decodes 8 headers, the first 8 bytes of each packet are transposed into one vector per word,
+   * the fourth word (the first data field bytes) is dropped and the three others are byte swapped.
+   */
+  void decodePrimaryHeadersSse2(const std::uint8_t *pData, const std::uint64_t *offsets,
+                                std::uint16_t *identification, std::uint16_t *sequenceControl,
+                                std::uint16_t *dataLength) {
+    __m128i h[8];
+    for (int i = 0; i < 8; ++i) {
+      h[i] = _mm_loadl_epi64(reinterpret_cast<const __m128i *>(pData + offsets[i]));
+    }
+    // a0 b0 a1 b1 a2 b2 a3 b3, then a0 b0 c0 d0 a1 b1 c1 d1 and a2 b2 c2 d2 a3 b3 c3 d3.
+    const __m128i ab = _mm_unpacklo_epi16(h[0], h[1]);
+    const __m128i cd = _mm_unpacklo_epi16(h[2], h[3]);
+    const __m128i ef = _mm_unpacklo_epi16(h[4], h[5]);
+    const __m128i gh = _mm_unpacklo_epi16(h[6], h[7]);
+    const __m128i abcd01 = _mm_unpacklo_epi32(ab, cd);
+    const __m128i abcd23 = _mm_unpackhi_epi32(ab, cd);
+    const __m128i efgh01 = _mm_unpacklo_epi32(ef, gh);
+    const __m128i efgh23 = _mm_unpackhi_epi32(ef, gh);
+    const __m128i words[3] = {_mm_unpacklo_epi64(abcd01, efgh01), _mm_unpackhi_epi64(abcd01, efgh01),
+                              _mm_unpacklo_epi64(abcd23, efgh23)};
+    std::uint16_t *destinations[3] = {identification, sequenceControl, dataLength};
+    for (int i = 0; i < 3; ++i) {
+      const __m128i swapped = _mm_or_si128(_mm_slli_epi16(words[i], 8), _mm_srli_epi16(words[i], 8));
+      _mm_storeu_si128(reinterpret_cast<__m128i *>(destinations[i]), swapped);
+    }
+  }
+#endif
+
+#ifdef CCSDS_HEADER_DECODE_NEON
+  /** @brief NEON variant of decodePrimaryHeadersSse2, the transposition de-interleaves the words twice. */
+  void decodePrimaryHeadersNeon(const std::uint8_t *pData, const std::uint64_t *offsets,
+                                std::uint16_t *identification, std::uint16_t *sequenceControl,
+                                std::uint16_t *dataLength) {
+    uint16x8_t pairs[4];
+    for (int i = 0; i < 4; ++i) {
+      pairs[i] = vcombine_u16(vreinterpret_u16_u8(vld1_u8(pData + offsets[2 * i])),
+                              vreinterpret_u16_u8(vld1_u8(pData + offsets[2 * i + 1])));
+    }
+    // even words a0 a2 b0 b2 ..., odd words a1 a3 b1 b3 ..., then words 0 and 2, 1 and 3 of every header.
+    const uint16x8x2_t abcd = vuzpq_u16(pairs[0], pairs[1]);
+    const uint16x8x2_t efgh = vuzpq_u16(pairs[2], pairs[3]);
+    const uint16x8x2_t even = vuzpq_u16(abcd.val[0], efgh.val[0]);
+    const uint16x8x2_t odd = vuzpq_u16(abcd.val[1], efgh.val[1]);
+    vst1q_u16(identification, vreinterpretq_u16_u8(vrev16q_u8(vreinterpretq_u8_u16(even.val[0]))));
+    vst1q_u16(sequenceControl, vreinterpretq_u16_u8(vrev16q_u8(vreinterpretq_u8_u16(odd.val[0]))));
+    vst1q_u16(dataLength, vreinterpretq_u16_u8(vrev16q_u8(vreinterpretq_u8_u16(even.val[1]))));
+  }
+#endif
+}
+
+void CCSDS::decodePrimaryHeaders(const std::uint8_t *pData, const std::uint64_t *offsets, const std::size_t count,
+                                 std::uint16_t *identification, std::uint16_t *sequenceControl,
+                                 std::uint16_t *dataLength) {
+  std::size_t row = 0;
+#if defined(CCSDS_HEADER_DECODE_X86)
+  for (; row + 8 <= count; row += 8) {
+    decodePrimaryHeadersSse2(pData, offsets + row, identification + row, sequenceControl + row, dataLength + row);
+  }
+#elif defined(CCSDS_HEADER_DECODE_NEON)
+  for (; row + 8 <= count; row += 8) {
+    decodePrimaryHeadersNeon(pData, offsets + row, identification + row, sequenceControl + row, dataLength + row);
+  }
+#endif
+  // tail not covered by a full batch, or every header without SIMD support.
+  for (; row < count; ++row) {
+    const std::uint8_t *pHeader = pData + offsets[row];
+    identification[row] = readWord(pHeader);
+    sequenceControl[row] = readWord(pHeader + 2);
+    dataLength[row] = readWord(pHeader + 4);
+  }
+}
+
 CCSDS::ResultBool CCSDS::Header::deserialize(const std::vector<std::uint8_t> &data) {
   RET_IF_ERR_MSG(data.size() != 6, ErrorCode::INVALID_HEADER_DATA, "Invalid Header Data provided: size != 6");
+  FORWARD_RESULT(deserialize(data.data(), data.size()));
+  return true;
+}
 
-  std::uint64_t headerData = 0;
-  for (std::uint8_t i = 0; i < 6; ++i) {
-    headerData |= static_cast<std::uint64_t>(data[i]) << (40 - i * 8); // Combine MSB to LSB
-  }
-  FORWARD_RESULT(setData(headerData));
+CCSDS::ResultBool CCSDS::Header::deserialize(const std::uint8_t *pData, const std::size_t sizeData) {
+  RET_IF_ERR_MSG(!pData, ErrorCode::NULL_POINTER, "Invalid Header Data provided: data is nullptr");
+  RET_IF_ERR_MSG(sizeData < kPrimaryHeaderSize, ErrorCode::INVALID_HEADER_DATA,
+                 "Invalid Header Data provided: size < 6");
+  setData(decodePrimaryHeader(pData));
   return true;
 }
 
@@ -40,15 +136,8 @@ std::vector<std::uint8_t> CCSDS::Header::serialize() {
   m_packetIdentificationAndVersion = (static_cast<std::uint16_t>(m_versionNumber) << 13) | (m_type << 12) | static_cast<
                                        std::uint16_t>((m_dataFieldHeaderFlag) << 11) | m_APID;
 
-  std::vector data{
-    static_cast<unsigned char>(m_packetIdentificationAndVersion >> 8),
-    static_cast<unsigned char>(m_packetIdentificationAndVersion & 0xFF),
-    static_cast<unsigned char>(m_packetSequenceControl >> 8),
-    static_cast<unsigned char>(m_packetSequenceControl & 0xFF),
-    static_cast<unsigned char>(m_dataLength >> 8),
-    static_cast<unsigned char>(m_dataLength & 0xFF),
-  };
-  return data;
+  const auto data = encodePrimaryHeader(getData());
+  return {data.begin(), data.end()};
 }
 
 void CCSDS::Header::setData(const PrimaryHeader &data) {
@@ -7,6 +7,17 @@
 #include "CCSDSManager.h"
 #include "CCSDSUtils.h"
 
+//exclude includes when building for MCU
+#ifndef CCSDS_MCU
+  #include <optional>
+  #include <thread>
+  #include "CCSDSMappedFile.h"
+#endif //CCSDS_MCU
+
+namespace {
+  constexpr std::size_t kMinPacketsPerThread = 16; ///< below this a thread costs more than the packets it builds.
+}
+
 void CCSDS::Manager::setSyncPattern(std::uint32_t syncPattern) { m_syncPattern = syncPattern; }
 
 uint32_t CCSDS::Manager::getSyncPattern() const { return m_syncPattern; }
@@ -15,6 +26,14 @@ void CCSDS::Manager::setSyncPatternEnable(const bool enable) { m_syncPattEnable
 
 bool CCSDS::Manager::getSyncPatternEnable() const { return m_syncPattEnable; }
 
+void CCSDS::Manager::setResyncEnable(const bool enable) { m_resyncEnable = enable; }
+
+bool CCSDS::Manager::getResyncEnable() const { return m_resyncEnable; }
+
+std::uint64_t CCSDS::Manager::getSkippedRegions() const { return m_skippedRegions; }
+
+std::uint64_t CCSDS::Manager::getSkippedBytes() const { return m_skippedBytes; }
+
 CCSDS::ResultBool CCSDS::Manager::setPacketTemplate(Packet packet) {
   RET_IF_ERR_MSG(m_templateIsSet, ErrorCode::TEMPLATE_SET_FAILURE, "Cannot set Template as it is already set, please clear Manager first");
   m_templatePacket.setUpdatePacketEnable(false);
@@ -32,6 +51,8 @@ CCSDS::ResultBool CCSDS::Manager::loadTemplateConfigFile(const std::string &conf
   FORWARD_RESULT(templatePacket.loadFromConfigFile(configPath));
   m_templatePacket = std::move(templatePacket);
   m_templateIsSet = true;
+  m_validator.setTemplatePacket(m_templatePacket);
+  m_validator.configure(true, true, true);
   return true;;
 }
 #ifndef CCSDS_MCU
@@ -41,6 +62,8 @@ CCSDS::ResultBool CCSDS::Manager::loadTemplateConfigFile(const std::string &conf
   FORWARD_RESULT(templatePacket.loadFromConfig(cfg));
   m_templatePacket = std::move(templatePacket);
   m_templateIsSet = true;
+  m_validator.setTemplatePacket(m_templatePacket);
+  m_validator.configure(true, true, true);
   return true;;
 }
 #endif
@@ -57,47 +80,162 @@ CCSDS::ResultBool CCSDS::Manager::setApplicationData(const std::vector<std::uint
   RET_IF_ERR_MSG(!m_templateIsSet, ErrorCode::INVALID_HEADER_DATA, "Cannot set Application data, No template has been set");
 
   const auto maxBytesPerPacket = m_templatePacket.getDataFieldMaximumSize();
-  const auto dataBytesSize = data.size();
+  RET_IF_ERR_MSG(maxBytesPerPacket == 0, ErrorCode::INVALID_APPLICATION_DATA,
+                 "Cannot set Application data, the template leaves no room for application data");
+
+  recyclePackets();
+
+  const auto segments = planSegments(data.size(), maxBytesPerPacket);
+#ifndef CCSDS_MCU
+  std::uint32_t threadCount = m_threadCount == 0 ? std::thread::hardware_concurrency() : m_threadCount;
+  threadCount = static_cast<std::uint32_t>(std::min<std::size_t>(threadCount, segments.size() / kMinPacketsPerThread));
+  // every packet needs its own secondary header to be updated concurrently with the others.
+  if (Packet probe = m_templatePacket; threadCount > 1 && probe.detachSecondaryHeader()) {
+    FORWARD_RESULT(buildSegmentsParallel(data, segments, threadCount));
+    return true;
+  }
+#endif
+
+  m_packets.reserve(segments.size());
+  for (const auto &segment : segments) {
+    Packet newPacket = acquirePacket();
+    newPacket = m_templatePacket;
+    FORWARD_RESULT(fillSegment(newPacket, data, segment));
+    m_packets.push_back(std::move(newPacket));
+  }
+  return true;
+}
+
+void CCSDS::Manager::setThreadCount(const std::uint32_t count) { m_threadCount = count; }
+
+std::uint32_t CCSDS::Manager::getThreadCount() const { return m_threadCount; }
 
-  if (!m_packets.empty()) {
-    m_packets.clear();
+void CCSDS::Manager::setPacketPoolSize(const std::size_t maxPackets) {
+  m_packetPoolSize = maxPackets;
+  if (m_packetPool.size() > maxPackets) {
+    m_packetPool.resize(maxPackets);
   }
+  if (maxPackets == 0) {
+    m_packetPool.shrink_to_fit();
+  }
+}
+
+std::size_t CCSDS::Manager::getPacketPoolSize() const { return m_packetPoolSize; }
 
-  std::uint32_t i = 0;
-  auto remainderBytes = static_cast<std::int32_t>(dataBytesSize);
+std::size_t CCSDS::Manager::getPooledPackets() const { return m_packetPool.size(); }
+
+CCSDS::Packet CCSDS::Manager::acquirePacket() {
+  if (m_packetPool.empty()) {
+    return {};
+  }
+  Packet packet = std::move(m_packetPool.back());
+  m_packetPool.pop_back();
+  packet.clear();
+  return packet;
+}
+
+void CCSDS::Manager::recyclePackets() {
+  for (auto &packet : m_packets) {
+    if (m_packetPool.size() >= m_packetPoolSize) {
+      break;
+    }
+    m_packetPool.push_back(std::move(packet));
+  }
+  m_packets.clear();
+  m_packetIndex.clear(); // the index describes the stored packets only.
+}
+
+std::vector<CCSDS::Manager::Segment> CCSDS::Manager::planSegments(const std::size_t sizeData,
+                                                                  const std::uint16_t maxBytesPerPacket) {
+  std::vector<Segment> segments;
+  segments.reserve((sizeData + maxBytesPerPacket - 1) / maxBytesPerPacket);
+  std::size_t offset = 0;
   auto sequenceFlag = UNSEGMENTED;
-  while (i < dataBytesSize) {
-    Packet newPacket = m_templatePacket;
-    std::vector<std::uint8_t> tmp;
+  while (offset < sizeData) {
+    Segment segment;
+    segment.offset = offset;
+    const std::size_t remainderBytes = sizeData - offset;
     if (remainderBytes > maxBytesPerPacket) {
-      tmp.insert(tmp.end(), data.begin() + i, data.begin() + i + maxBytesPerPacket);
-      remainderBytes -= maxBytesPerPacket;
-      if (i == 0) {
+      segment.size = maxBytesPerPacket;
+      if (offset == 0) {
         sequenceFlag = FIRST_SEGMENT;
         m_sequenceCount++;
       } else {
         sequenceFlag = CONTINUING_SEGMENT;
       }
-      i += maxBytesPerPacket;
-      FORWARD_RESULT(newPacket.setApplicationData(tmp));
-      newPacket.setSequenceFlags(sequenceFlag);
-      FORWARD_RESULT(newPacket.setSequenceCount(m_sequenceCount));
+      segment.sequenceFlag = sequenceFlag;
+      segment.sequenceCount = m_sequenceCount;
+      segment.setSequence = true;
     } else {
-      tmp.insert(tmp.end(), data.begin() + i, data.begin() + i + remainderBytes);
-      i += remainderBytes;
+      segment.size = static_cast<std::uint16_t>(remainderBytes);
       if (sequenceFlag != UNSEGMENTED) {
-        newPacket.setSequenceFlags(LAST_SEGMENT);
-        FORWARD_RESULT(newPacket.setSequenceCount(m_sequenceCount));
+        segment.sequenceFlag = LAST_SEGMENT;
+        segment.sequenceCount = m_sequenceCount;
+        segment.setSequence = true;
       }
-      FORWARD_RESULT(newPacket.setApplicationData(tmp));
     }
-    newPacket.setUpdatePacketEnable(m_updateEnable);
-    m_packets.push_back(std::move(newPacket));
+    offset += segment.size;
     m_sequenceCount++;
+    segments.push_back(segment);
   }
+  return segments;
+}
+
+CCSDS::ResultBool CCSDS::Manager::fillSegment(Packet &packet, const std::vector<std::uint8_t> &data,
+                                              const Segment &segment) const {
+  FORWARD_RESULT(packet.setApplicationData(data.data() + segment.offset, segment.size));
+  if (segment.setSequence) {
+    packet.setSequenceFlags(segment.sequenceFlag);
+    FORWARD_RESULT(packet.setSequenceCount(segment.sequenceCount));
+  }
+  packet.setUpdatePacketEnable(m_updateEnable);
   return true;
 }
 
+#ifndef CCSDS_MCU
+CCSDS::ResultBool CCSDS::Manager::buildSegmentsParallel(const std::vector<std::uint8_t> &data,
+                                                        const std::vector<Segment> &segments,
+                                                        const std::uint32_t threadCount) {
+  // each thread builds a contiguous range of packets into its own slots, no locking is needed.
+  std::vector<std::optional<Packet>> slots(segments.size());
+  std::vector<std::optional<Error>> errors(threadCount);
+  auto buildRange = [&](const std::uint32_t thread) {
+    const std::size_t first = segments.size() * thread / threadCount;
+    const std::size_t last = segments.size() * (thread + 1) / threadCount;
+    for (std::size_t index = first; index < last; ++index) {
+      Packet &packet = slots[index].emplace(m_templatePacket);
+      packet.detachSecondaryHeader();
+      if (const auto res = fillSegment(packet, data, segments[index]); !res.has_value()) {
+        errors[thread] = res.error();
+        return;
+      }
+      packet.update(); // secondary header and CRC are computed here rather than on first access.
+    }
+  };
+
+  std::vector<std::thread> workers;
+  workers.reserve(threadCount - 1);
+  for (std::uint32_t thread = 1; thread < threadCount; ++thread) {
+    workers.emplace_back(buildRange, thread);
+  }
+  buildRange(0);
+  for (auto &worker : workers) {
+    worker.join();
+  }
+
+  for (const auto &error : errors) {
+    if (error.has_value()) {
+      return error.value();
+    }
+  }
+  m_packets.reserve(segments.size());
+  for (auto &slot : slots) {
+    m_packets.push_back(std::move(slot.value()));
+  }
+  return true;
+}
+#endif
+
 void CCSDS::Manager::setAutoUpdateEnable(const bool enable) {
   m_updateEnable = enable;
   for (auto &packet: m_packets) {
@@ -120,25 +258,38 @@ CCSDS::ResultBuffer CCSDS::Manager::getPacketBufferAtIndex(const std::uint16_t i
                  "Cannot get packet, index is out of bounds");
   if (m_validateEnable) {
     m_packets[index].update();
-    const std::string errorMessage = "Validation failure for packet at index " + std::to_string(index);
-    RET_IF_ERR_MSG(!m_validator.validate(m_packets[index]), ErrorCode::VALIDATION_FAILURE,
-                   errorMessage);
+    if (!m_validator.validate(m_packets[index])) {
+      return Error{ErrorCode::VALIDATION_FAILURE, "Validation failure for packet"}.withIndex(index);
+    }
   }
   return m_packets[index].serialize();
 }
 
-std::vector<std::uint8_t> CCSDS::Manager::getPacketsBuffer() const {
-  std::vector<std::uint8_t> buffer;
-  for (auto packet : m_packets) {
+std::size_t CCSDS::Manager::getPacketsBufferSize() const {
+  const std::size_t prefixSize = m_syncPattEnable ? 4 : 0;
+  std::size_t bufferSize = 0;
+  for (const auto &packet : m_packets) {
+    bufferSize += prefixSize + packet.getFullPacketLength();
+  }
+  return bufferSize;
+}
+
+std::vector<std::uint8_t> CCSDS::Manager::getPacketsBuffer() {
+  // sized once, every packet is then written in place.
+  std::vector<std::uint8_t> buffer(getPacketsBufferSize());
+  std::size_t offset = 0;
+  for (auto &packet : m_packets) {
     if (m_syncPattEnable) {
-      buffer.push_back(m_syncPattern >> 24 & 0xff);
-      buffer.push_back(m_syncPattern >> 16 & 0xff);
-      buffer.push_back(m_syncPattern >> 8 & 0xff);
-      buffer.push_back(m_syncPattern & 0xff);
+      buffer[offset++] = m_syncPattern >> 24 & 0xff;
+      buffer[offset++] = m_syncPattern >> 16 & 0xff;
+      buffer[offset++] = m_syncPattern >> 8 & 0xff;
+      buffer[offset++] = m_syncPattern & 0xff;
+    }
+    if (const auto res = packet.serializeInto(buffer.data() + offset, buffer.size() - offset); res.has_value()) {
+      offset += res.value();
     }
-    std::vector<std::uint8_t> packetBuffer = packet.serialize();
-    buffer.insert(buffer.end(), packetBuffer.begin(), packetBuffer.end());
   }
+  buffer.resize(offset);
   return buffer;
 }
 
@@ -148,9 +299,9 @@ CCSDS::ResultBuffer CCSDS::Manager::getApplicationDataBuffer() {
 
   for (std::uint32_t index = 0; index < m_packets.size(); index++) {
     if (m_validateEnable) {
-      const std::string errorMessage = "Validation failure for packet at index" + std::to_string(index);
-      RET_IF_ERR_MSG(!m_validator.validate(m_packets[index]), ErrorCode::VALIDATION_FAILURE,
-                     errorMessage);
+      if (!m_validator.validate(m_packets[index])) {
+        return Error{ErrorCode::VALIDATION_FAILURE, "Validation failure for packet"}.withIndex(index);
+      }
     }
     auto applicationData = m_packets[index].getApplicationDataBytes();
     data.insert(data.end(), applicationData.begin(), applicationData.end());
@@ -192,6 +343,13 @@ CCSDS::ResultBool CCSDS::Manager::addPacketFromBuffer(const std::vector<std::uin
   return true;
 }
 
+CCSDS::ResultBool CCSDS::Manager::addPacketFromView(const PacketView& packetView) {
+  Packet packet = acquirePacket();
+  FORWARD_RESULT(packet.deserialize(packetView));
+  FORWARD_RESULT(addPacket(std::move(packet)));
+  return true;
+}
+
 
 [[nodiscard]] CCSDS::ResultBool CCSDS::Manager::load(const std::vector<Packet>& packets) {
 
@@ -202,41 +360,99 @@ CCSDS::ResultBool CCSDS::Manager::addPacketFromBuffer(const std::vector<std::uin
 }
 
 [[nodiscard]] CCSDS::ResultBool CCSDS::Manager::load(const std::vector<std::uint8_t>& packetsBuffer) {
-  RET_IF_ERR_MSG(packetsBuffer.size() < 8, ErrorCode::INVALID_DATA, "invalid packet buffer size");
-  std::uint32_t offset{0};
-  while (offset < packetsBuffer.size()) {
-    std::vector<std::uint8_t> headerData;
-    if (m_syncPattEnable) {
-      const std::uint32_t value = (static_cast<std::uint32_t>(packetsBuffer[offset]) << 24) |
-                             (static_cast<std::uint32_t>(packetsBuffer[offset+1]) << 16) |
-                             (static_cast<std::uint32_t>(packetsBuffer[offset+2]) << 8)  |
-                             (static_cast<std::uint32_t>(packetsBuffer[offset+3]));
-      RET_IF_ERR_MSG(value != m_syncPattern, ErrorCode::INVALID_DATA, "Sync Pattern mismatch.");
-      offset += 4;
+  FORWARD_RESULT(load(packetsBuffer.data(), packetsBuffer.size()));
+  return true;
+}
+
+CCSDS::ResultBool CCSDS::Manager::load(const std::uint8_t *pData, const size_t sizeData) {
+  m_views.clear();
+  FORWARD_RESULT(getPacketViews(pData, sizeData, m_views));
+  m_packets.reserve(m_packets.size() + m_views.size());
+  for (const auto &view: m_views) {
+    FORWARD_RESULT(addPacketFromView(view));
+  }
+  if (m_indexEnable) {
+    m_packetIndex.add(pData, m_views.data(), m_views.size());
+  }
+  return true;
+}
+
+CCSDS::ResultBool CCSDS::Manager::indexPackets(const std::uint8_t *pData, const size_t sizeData, PacketIndex &index) {
+  if (m_syncPattEnable) {
+    m_views.clear();
+    FORWARD_RESULT(getPacketViews(pData, sizeData, m_views));
+    index.add(pData, m_views.data(), m_views.size());
+    return true;
+  }
+  // without sync pattern every packet starts where the previous one ends, only the data lengths are read.
+  RET_IF_ERR_MSG(!pData, ErrorCode::NULL_POINTER, "packet buffer is nullptr");
+  RET_IF_ERR_MSG(sizeData < 8, ErrorCode::INVALID_DATA, "invalid packet buffer size");
+  m_skippedRegions = 0;
+  m_skippedBytes = 0;
+  m_offsets.clear();
+  std::size_t offset = 0;
+  while (offset + 6 <= sizeData) {
+    const std::size_t packetSize = static_cast<std::size_t>(pData[offset + 4] << 8 | pData[offset + 5]) + 8;
+    if (packetSize > sizeData - offset) {
+      break;
     }
-    headerData.clear();
-    copy_n(packetsBuffer.begin() + offset, 6, std::back_inserter(headerData));
-    Header header;
-    FORWARD_RESULT( header.deserialize(headerData));
-
-    const std::uint16_t packetSize = header.getDataLength() + 8;
-    std::vector<std::uint8_t>packetData;
-    packetData.clear();
-    copy_n(packetsBuffer.begin() + offset, packetSize, std::back_inserter(packetData));
-    FORWARD_RESULT(addPacketFromBuffer(packetData));
+    m_offsets.push_back(offset);
     offset += packetSize;
   }
+  RET_IF_ERR_MSG(offset != sizeData, ErrorCode::INVALID_DATA,
+                 "Packet truncated, buffer ends before the declared data length.");
+  index.add(pData, m_offsets.data(), m_offsets.size());
+  return true;
+}
+
+void CCSDS::Manager::setPacketIndexEnable(const bool enable) { m_indexEnable = enable; }
+
+bool CCSDS::Manager::getPacketIndexEnable() const { return m_indexEnable; }
+
+CCSDS::ResultBool CCSDS::Manager::getPacketViews(const std::uint8_t *pData, const size_t sizeData,
+                                                 std::vector<PacketView> &views) {
+  RET_IF_ERR_MSG(!pData, ErrorCode::NULL_POINTER, "packet buffer is nullptr");
+  RET_IF_ERR_MSG(sizeData < 8, ErrorCode::INVALID_DATA, "invalid packet buffer size");
+  m_skippedRegions = 0;
+  m_skippedBytes = 0;
+  StreamDecoder decoder;
+  decoder.setSyncPatternEnable(m_syncPattEnable);
+  decoder.setSyncPattern(m_syncPattern);
+  decoder.setResyncEnable(m_resyncEnable);
+  decoder.push(pData, sizeData);
+  PacketView view;
+  bool packetFound{false};
+  // the whole buffer is pushed at once, so every returned view points into it.
+  ASSIGN_CP(packetFound, decoder.next(view));
+  while (packetFound) {
+    views.push_back(view);
+    ASSIGN_CP(packetFound, decoder.next(view));
+  }
+  if (m_resyncEnable && m_syncPattEnable) {
+    decoder.skipBuffered();
+  }
+  m_skippedRegions = decoder.getSkippedRegions();
+  m_skippedBytes = decoder.getSkippedBytes();
+  RET_IF_ERR_MSG(decoder.getBufferedBytes() != 0, ErrorCode::INVALID_DATA,
+                 "Packet truncated, buffer ends before the declared data length.");
   return true;
 }
 
 CCSDS::ResultBool CCSDS::Manager::read(const std::string &binaryFile) {
+#ifndef CCSDS_MCU
+  // packets are deserialized straight from the mapped pages, the file is not copied to the heap.
+  MappedFile file;
+  FORWARD_RESULT(file.open(binaryFile));
+  FORWARD_RESULT(load(file.data(), file.size()));
+#else
   std::vector<std::uint8_t> buffer;
   ASSIGN_CP(buffer, readBinaryFile(binaryFile));
   FORWARD_RESULT(load(buffer));
+#endif
   return true;
 }
 
-CCSDS::ResultBool CCSDS::Manager::write(const std::string& binaryFile) const {
+CCSDS::ResultBool CCSDS::Manager::write(const std::string& binaryFile) {
   FORWARD_RESULT(writeBinaryFile(getPacketsBuffer(),binaryFile));
   return true;
 }
@@ -265,7 +481,7 @@ void CCSDS::Manager::clear() {
 }
 
 void CCSDS::Manager::clearPackets() {
-  m_packets.clear();
+  recyclePackets();
   m_sequenceCount = 0;
   m_validator.clear();
 }
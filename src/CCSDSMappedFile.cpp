@@ -0,0 +1,135 @@
+// Copyright 2025-2026 ExoSpaceLabs
+// SPDX-License-Identifier: Apache-2.0
+
+#include "CCSDSMappedFile.h"
+#include <utility>
+
+#ifdef _WIN32
+  #ifndef NOMINMAX
+    #define NOMINMAX
+  #endif
+  #include <windows.h>
+#else
+  #include <fcntl.h>
+  #include <sys/mman.h>
+  #include <sys/stat.h>
+  #include <unistd.h>
+#endif
+
+CCSDS::MappedFile::~MappedFile() {
+  close();
+}
+
+CCSDS::MappedFile::MappedFile(MappedFile &&other) noexcept {
+  *this = std::move(other);
+}
+
+CCSDS::MappedFile &CCSDS::MappedFile::operator=(MappedFile &&other) noexcept {
+  if (this != &other) {
+    close();
+    m_data = std::exchange(other.m_data, nullptr);
+    m_size = std::exchange(other.m_size, 0);
+    m_isOpen = std::exchange(other.m_isOpen, false);
+#ifdef _WIN32
+    m_fileHandle = std::exchange(other.m_fileHandle, nullptr);
+    m_mappingHandle = std::exchange(other.m_mappingHandle, nullptr);
+#endif
+  }
+  return *this;
+}
+
+#ifdef _WIN32
+
+CCSDS::ResultBool CCSDS::MappedFile::open(const std::string &filename, const bool sequential) {
+  close();
+  RET_IF_ERR_MSG(filename.empty(), ErrorCode::FILE_READ_ERROR, "No filename provided");
+  const DWORD accessHint = sequential ? FILE_FLAG_SEQUENTIAL_SCAN : FILE_FLAG_RANDOM_ACCESS;
+  HANDLE file = CreateFileA(filename.c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING,
+                            FILE_ATTRIBUTE_NORMAL | accessHint, nullptr);
+  RET_IF_ERR_MSG(file == INVALID_HANDLE_VALUE, ErrorCode::FILE_READ_ERROR, "Failed to open file for reading");
+  LARGE_INTEGER fileSize;
+  if (!GetFileSizeEx(file, &fileSize)) {
+    CloseHandle(file);
+    return Error{ErrorCode::FILE_READ_ERROR, "Failed to get the file size"};
+  }
+  m_fileHandle = file;
+  m_isOpen = true;
+  m_size = static_cast<std::size_t>(fileSize.QuadPart);
+  if (m_size == 0) {
+    return true; // empty files cannot be mapped.
+  }
+  HANDLE mapping = CreateFileMappingA(file, nullptr, PAGE_READONLY, 0, 0, nullptr);
+  if (mapping == nullptr) {
+    close();
+    return Error{ErrorCode::FILE_READ_ERROR, "Failed to map the file"};
+  }
+  m_mappingHandle = mapping;
+  m_data = static_cast<const std::uint8_t *>(MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0));
+  if (m_data == nullptr) {
+    close();
+    return Error{ErrorCode::FILE_READ_ERROR, "Failed to map the file"};
+  }
+  return true;
+}
+
+void CCSDS::MappedFile::close() {
+  if (m_data != nullptr) {
+    UnmapViewOfFile(m_data);
+  }
+  if (m_mappingHandle != nullptr) {
+    CloseHandle(m_mappingHandle);
+  }
+  if (m_fileHandle != nullptr) {
+    CloseHandle(m_fileHandle);
+  }
+  m_data = nullptr;
+  m_size = 0;
+  m_isOpen = false;
+  m_fileHandle = nullptr;
+  m_mappingHandle = nullptr;
+}
+
+#else
+
+CCSDS::ResultBool CCSDS::MappedFile::open(const std::string &filename, const bool sequential) {
+  close();
+  RET_IF_ERR_MSG(filename.empty(), ErrorCode::FILE_READ_ERROR, "No filename provided");
+  const int fd = ::open(filename.c_str(), O_RDONLY);
+  RET_IF_ERR_MSG(fd < 0, ErrorCode::FILE_READ_ERROR, "Failed to open file for reading");
+  struct stat fileStat{};
+  if (fstat(fd, &fileStat) != 0 || !S_ISREG(fileStat.st_mode)) {
+    ::close(fd);
+    return Error{ErrorCode::FILE_READ_ERROR, "Failed to open file for reading, not a regular file"};
+  }
+  m_isOpen = true;
+  m_size = static_cast<std::size_t>(fileStat.st_size);
+  if (m_size == 0) {
+    ::close(fd);
+    return true; // empty files cannot be mapped.
+  }
+  void *address = mmap(nullptr, m_size, PROT_READ, MAP_PRIVATE, fd, 0);
+  ::close(fd); // the mapping keeps its own reference to the file.
+  if (address == MAP_FAILED) {
+    m_size = 0;
+    m_isOpen = false;
+    return Error{ErrorCode::FILE_READ_ERROR, "Failed to map the file"};
+  }
+#if defined(MADV_SEQUENTIAL) && defined(MADV_RANDOM)
+  // packets are framed front to back, let the kernel read ahead aggressively and drop pages behind.
+  // random lookups only touch the pages they need, read ahead would load the rest of the capture.
+  madvise(address, m_size, sequential ? MADV_SEQUENTIAL : MADV_RANDOM);
+#endif
+  m_data = static_cast<const std::uint8_t *>(address);
+  return true;
+}
+
+void CCSDS::MappedFile::close() {
+  if (m_data != nullptr) {
+    munmap(const_cast<std::uint8_t *>(m_data), m_size);
+  }
+  m_data = nullptr;
+  m_size = 0;
+  m_isOpen = false;
+}
+
+#endif
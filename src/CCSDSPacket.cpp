@@ -6,27 +6,50 @@
 #include "CCSDSUtils.h"
 #include <algorithm>
 
+namespace {
+  constexpr std::uint16_t kHeaderStackBytes = 64; ///< secondary headers up to this size are serialized on the stack.
+}
+
 //exclude includes when building for MCU
 #ifndef CCSDS_MCU
   #include "CCSDSConfig.h"
 #endif //CCSDS_MCU
 
 void CCSDS::Packet::update() {
-  if (!m_updateStatus && m_enableUpdatePacket) {
-    const auto dataField = m_dataField.serialize();
-    const auto dataFiledSize = static_cast<std::uint16_t>(dataField.size());
-    const auto dataFieldHeaderFlag(m_dataField.getDataFieldHeaderFlag());
-    m_primaryHeader.setDataLength(dataFiledSize);
-    m_primaryHeader.setDataFieldHeaderFlag(dataFieldHeaderFlag);
-    // todo this part needs to be moved out of conditional updating
-    if (m_primaryHeader.getSequenceFlags() == UNSEGMENTED) {
-      m_primaryHeader.setSequenceCount(0);
-    } else {
-      m_primaryHeader.setSequenceCount(m_sequenceCounter);
+  if (m_dirty == kClean || !m_enableUpdatePacket) {
+    return;
+  }
+  if (m_dirty & kDirtyCrc) {
+    // the CRC is chained over secondary header and application data, the data field is not concatenated.
+    // the secondary header is written to the stack, unless it is larger than the PUS headers by far.
+    std::uint8_t headerBuffer[kHeaderStackBytes];
+    std::vector<std::uint8_t> headerHeapBuffer;
+    std::uint8_t *header = headerBuffer;
+    if (const auto headerSize = m_dataField.getDataFieldHeaderBytesSize(); headerSize > kHeaderStackBytes) {
+      headerHeapBuffer.resize(headerSize);
+      header = headerHeapBuffer.data();
     }
-    m_CRC16 = crc16(dataField, m_CRC16Config.polynomial, m_CRC16Config.initialValue, m_CRC16Config.finalXorValue);
-    m_updateStatus = true;
+    const std::uint16_t headerSize = m_dataField.serializeDataFieldHeaderInto(header);
+    if (m_dirty & kDirtyApplicationCrc) {
+      const auto &applicationData = m_dataField.getApplicationDataReference();
+      m_applicationDataCrc = CRC16State({m_CRC16Config.polynomial, 0x0000, 0x0000});
+      m_applicationDataCrc.append(applicationData.data(), applicationData.size());
+    }
+    const auto &engine = CRC16Engine::get(m_CRC16Config.polynomial);
+    const auto crc = engine.compute(header, headerSize, m_CRC16Config.initialValue);
+    m_CRC16 = engine.combine(crc, m_applicationDataCrc.getRegister(), m_applicationDataCrc.getSize()) ^
+              m_CRC16Config.finalXorValue;
+  }
+  // the primary header only depends on the data field sizes, sequence changes do not recompute the CRC.
+  m_primaryHeader.setDataLength(m_dataField.getDataFieldUsedBytesSize());
+  m_primaryHeader.setDataFieldHeaderFlag(m_dataField.getDataFieldHeaderFlag());
+  // todo this part needs to be moved out of conditional updating
+  if (m_primaryHeader.getSequenceFlags() == UNSEGMENTED) {
+    m_primaryHeader.setSequenceCount(0);
+  } else {
+    m_primaryHeader.setSequenceCount(m_sequenceCounter);
   }
+  m_dirty = kClean;
 }
 
 #ifndef CCSDS_MCU
@@ -57,11 +80,11 @@ CCSDS::ResultBool CCSDS::Packet::loadFromConfig(const Config &cfg) {
   RET_IF_ERR_MSG(!cfg.isKey( "ccsds_segmented"), ErrorCode::CONFIG_FILE_ERROR,
                  "Config: Missing bool field: ccsds_segmented");
 
-  ASSIGN_OR_PRINT(versionNumber, cfg.get< int>( "ccsds_version_number"));
-  ASSIGN_OR_PRINT(type, cfg.get<bool>( "ccsds_type"));
-  ASSIGN_OR_PRINT(dataFieldHeaderFlag, cfg.get<bool>("ccsds_data_field_header_flag"));
-  ASSIGN_OR_PRINT(APID, cfg.get< int>( "ccsds_APID"));
-  ASSIGN_OR_PRINT(segmented, cfg.get<bool>( "ccsds_segmented"));
+  ASSIGN_CONFIG_OR_PRINT(versionNumber, cfg, int, "ccsds_version_number");
+  ASSIGN_CONFIG_OR_PRINT(type, cfg, bool, "ccsds_type");
+  ASSIGN_CONFIG_OR_PRINT(dataFieldHeaderFlag, cfg, bool, "ccsds_data_field_header_flag");
+  ASSIGN_CONFIG_OR_PRINT(APID, cfg, int, "ccsds_APID");
+  ASSIGN_CONFIG_OR_PRINT(segmented, cfg, bool, "ccsds_segmented");
 
   m_primaryHeader.setVersionNumber(versionNumber);
   m_primaryHeader.setType(type);
@@ -79,13 +102,13 @@ CCSDS::ResultBool CCSDS::Packet::loadFromConfig(const Config &cfg) {
 
   if (cfg.isKey( "data_field_size")) { // optional field
     std::uint16_t dataFieldSize;
-    ASSIGN_OR_PRINT(dataFieldSize, cfg.get< int>( "data_field_size"));
+    ASSIGN_CONFIG_OR_PRINT(dataFieldSize, cfg, int, "data_field_size");
     m_dataField.setDataPacketSize(dataFieldSize);
   }
 
   if (cfg.isKey("define_secondary_header")) { // optional field
     bool secondaryHeaderFlag{false};
-    ASSIGN_OR_PRINT(secondaryHeaderFlag, cfg.get<bool>("define_secondary_header"));
+    ASSIGN_CONFIG_OR_PRINT(secondaryHeaderFlag, cfg, bool, "define_secondary_header");
     if (secondaryHeaderFlag) {
       FORWARD_RESULT( m_dataField.setDataFieldHeader(cfg));
     }
@@ -93,7 +116,7 @@ CCSDS::ResultBool CCSDS::Packet::loadFromConfig(const Config &cfg) {
 
   if (cfg.isKey("application_data")) { // optional field
     std::vector<std::uint8_t> applicationData{};
-    ASSIGN_OR_PRINT(applicationData, cfg.get<std::vector<std::uint8_t>>("application_data"));
+    ASSIGN_CONFIG_OR_PRINT(applicationData, cfg, std::vector<std::uint8_t>, "application_data");
     FORWARD_RESULT( m_dataField.setApplicationData(applicationData));
   }
 
@@ -158,21 +181,35 @@ std::vector<std::uint8_t> CCSDS::Packet::getFullDataFieldBytes() {
 }
 
 std::vector<std::uint8_t> CCSDS::Packet::serialize() {
-  auto header = getPrimaryHeaderBytes();
-  auto dataField = m_dataField.serialize();
-  const auto crc = getCRCVectorBytes();
-
-  std::vector<std::uint8_t> packet;
-  packet.reserve(header.size() + dataField.size() + crc.size());
-  packet.insert(packet.end(), header.begin(), header.end());
-  if (!getFullDataFieldBytes().empty()) {
-    packet.insert(packet.end(), dataField.begin(), dataField.end());
-  }
-  packet.insert(packet.end(), crc.begin(), crc.end());
-
+  update();
+  std::vector<std::uint8_t> packet(getFullPacketLength());
+  writePacket(packet.data());
   return packet;
 }
 
+CCSDS::Result<std::size_t> CCSDS::Packet::serializeInto(std::uint8_t *pData, const std::size_t capacity) {
+  RET_IF_ERR_MSG(!pData, ErrorCode::NULL_POINTER, "Cannot serialize Packet, destination buffer is nullptr");
+  update();
+  RET_IF_ERR_MSG(capacity < getFullPacketLength(), ErrorCode::INVALID_DATA,
+                 "Cannot serialize Packet, destination buffer is smaller than the packet");
+  return writePacket(pData);
+}
+
+CCSDS::Result<std::size_t> CCSDS::Packet::serializeInto(std::vector<std::uint8_t> &buffer) {
+  update();
+  const std::size_t offset = buffer.size();
+  buffer.resize(offset + getFullPacketLength());
+  return writePacket(buffer.data() + offset);
+}
+
+std::size_t CCSDS::Packet::writePacket(std::uint8_t *pData) {
+  m_primaryHeader.serializeInto(pData);
+  const std::size_t dataFieldSize = m_dataField.serializeInto(pData + 6);
+  pData[6 + dataFieldSize] = static_cast<std::uint8_t>(m_CRC16 >> 8);
+  pData[7 + dataFieldSize] = static_cast<std::uint8_t>(m_CRC16 & 0xFF);
+  return 8 + dataFieldSize;
+}
+
 CCSDS::ResultBool CCSDS::Packet::deserialize(const std::vector<std::uint8_t> &data) {
   RET_IF_ERR_MSG(data.size() <= 7, ErrorCode::INVALID_HEADER_DATA,
                  "Cannot Deserialize Packet, Invalid Data provided data size must be at least 8 bytes");
@@ -186,29 +223,38 @@ CCSDS::ResultBool CCSDS::Packet::deserialize(const std::vector<std::uint8_t> &da
 }
 
 CCSDS::ResultBool CCSDS::Packet::deserialize(const std::vector<std::uint8_t> &data, const std::string &headerType, const std::int32_t headerSize) {
-  RET_IF_ERR_MSG(data.size() <= 8, ErrorCode::INVALID_DATA,
-                 "Cannot Deserialize Packet, Invalid Data provided data size must be at least 8 bytes");
   RET_IF_ERR_MSG(headerType == "BufferHeader", ErrorCode::INVALID_SECONDARY_HEADER_DATA,
                  "Cannot Deserialize Packet, BufferHeader is not of defined size");
-  RET_IF_ERR_MSG(!m_dataField.getDataFieldHeaderFactory().typeIsRegistered(headerType),
-                 ErrorCode::INVALID_SECONDARY_HEADER_DATA,
-                 "Cannot Deserialize Packet, Unregistered Secondary header: " + headerType);
+  const auto typeId = m_dataField.getDataFieldHeaderFactory().getTypeId(headerType);
+  RET_IF_ERR_MSG(typeId == INVALID_TYPE_ID, ErrorCode::INVALID_SECONDARY_HEADER_DATA,
+                 "Cannot Deserialize Packet, Unregistered Secondary header");
+  FORWARD_RESULT(deserialize(data, typeId, headerSize));
+  return true;
+}
+
+CCSDS::ResultBool CCSDS::Packet::deserialize(const std::vector<std::uint8_t> &data, const SecondaryHeaderTypeId typeId, const std::int32_t headerSize) {
+  RET_IF_ERR_MSG(data.size() <= 8, ErrorCode::INVALID_DATA,
+                 "Cannot Deserialize Packet, Invalid Data provided data size must be at least 8 bytes");
+  const auto &factory = m_dataField.getDataFieldHeaderFactory();
+  RET_IF_ERR_MSG(!factory.typeIsRegistered(typeId), ErrorCode::INVALID_SECONDARY_HEADER_DATA,
+                 "Cannot Deserialize Packet, Unregistered Secondary header id");
   std::uint16_t headerDataSizeBytes{0};
-  const auto secondaryHeader = m_dataField.getDataFieldHeaderFactory().create(headerType);
-  if (headerType == "PusC" && headerSize > 0) {
+  if (factory.isVariableLength(typeId) && headerSize > 0) {
     headerDataSizeBytes = headerSize;
   }else {
-    headerDataSizeBytes = secondaryHeader->getSize();
+    headerDataSizeBytes = factory.getSize(typeId);
   }
+  RET_IF_ERR_MSG(headerDataSizeBytes == 0, ErrorCode::INVALID_SECONDARY_HEADER_DATA,
+                 "Cannot Deserialize Packet, Secondary header is not of defined size");
+  RET_IF_ERR_MSG(data.size() < 8u + headerDataSizeBytes, ErrorCode::INVALID_DATA,
+                 "Cannot Deserialize Packet, data is shorter than the secondary header");
 
-  std::vector<std::uint8_t> dataFieldHeaderVector;
-  std::copy_n(data.begin() + 6, headerDataSizeBytes, std::back_inserter(dataFieldHeaderVector));
-  FORWARD_RESULT(secondaryHeader->deserialize(dataFieldHeaderVector ));
-  setDataFieldHeader(secondaryHeader);
+  FORWARD_RESULT(m_dataField.setDataFieldHeader(data.data() + 6, headerDataSizeBytes, typeId));
+  m_dirty = kDirtyAll;
 
   std::vector<std::uint8_t> dataFieldVector;
-  if (data.size() > (6 + headerDataSizeBytes)) {
-    std::copy(data.begin() + 6 + headerDataSizeBytes, data.end(), std::back_inserter(dataFieldVector));
+  if (data.size() > (6u + headerDataSizeBytes)) {
+    dataFieldVector.assign(data.begin() + 6 + headerDataSizeBytes, data.end());
   }
   FORWARD_RESULT(deserialize({data[0], data[1], data[2], data[3], data[4], data[5]}, dataFieldVector));
 
@@ -250,22 +296,39 @@ CCSDS::ResultBool CCSDS::Packet::deserialize(const std::vector<std::uint8_t> &he
   return true;;
 }
 
-uint16_t CCSDS::Packet::getFullPacketLength() {
+CCSDS::ResultBool CCSDS::Packet::deserialize(const PacketView &view) {
+  RET_IF_ERR_MSG(!view.isValid(), ErrorCode::NO_DATA, "Cannot Deserialize Packet, the packet view is empty.");
+  m_primaryHeader.setData(decodePrimaryHeader(view.getPrimaryHeaderBytes().data));
+  m_sequenceCounter = m_primaryHeader.getSequenceCount();
+  m_CRC16 = view.getCRC();
+  m_dirty = kDirtyAll;
+
+  if (const auto secondaryHeader = view.getDataFieldHeaderBytes(); !secondaryHeader.empty()) {
+    FORWARD_RESULT(m_dataField.setDataFieldHeader(secondaryHeader.data, secondaryHeader.size));
+  }
+  const auto applicationData = view.getApplicationData();
+  if (applicationData.empty()) return true; // returns since no application data is to be written.
+
+  FORWARD_RESULT(m_dataField.setApplicationData(applicationData.data, applicationData.size));
+  return true;
+}
+
+std::size_t CCSDS::Packet::getFullPacketLength() const {
   // where 8 is derived from 6 bytes for Primary header and 2 bytes for CRC16.
-  return 8 + m_dataField.getDataFieldUsedBytesSize();
+  return 8 + static_cast<std::size_t>(m_dataField.getDataFieldUsedBytesSize());
 }
 
 CCSDS::ResultBool CCSDS::Packet::setPrimaryHeader(const std::uint64_t data) {
   FORWARD_RESULT(m_primaryHeader.setData( data ));
   m_sequenceCounter = m_primaryHeader.getSequenceCount();
-  m_updateStatus = false;
+  m_dirty |= kDirtyPrimaryHeader;
   return true;
 }
 
 CCSDS::ResultBool CCSDS::Packet::setPrimaryHeader(const std::vector<uint8_t> &data) {
   FORWARD_RESULT(m_primaryHeader.deserialize( data ));
   m_sequenceCounter = m_primaryHeader.getSequenceCount();
-  m_updateStatus = false;
+  m_dirty |= kDirtyPrimaryHeader;
   return true;
 }
 
@@ -276,61 +339,105 @@ void CCSDS::Packet::setPrimaryHeader(const Header &header) {
 void CCSDS::Packet::setPrimaryHeader(const PrimaryHeader data) {
   m_primaryHeader.setData(data);
   m_sequenceCounter = m_primaryHeader.getSequenceCount();
-  m_updateStatus = false;
+  m_dirty |= kDirtyPrimaryHeader;
 }
 
 void CCSDS::Packet::setDataFieldHeader(const std::shared_ptr<SecondaryHeaderAbstract> &header) {
   m_dataField.setDataFieldHeader(header);
-  m_updateStatus = false;
+  m_dirty |= kDirtyPrimaryHeader | kDirtyCrc;
+}
+
+bool CCSDS::Packet::detachSecondaryHeader() {
+  if (!m_dataField.detachSecondaryHeader()) {
+    return false;
+  }
+  m_dirty |= kDirtyPrimaryHeader | kDirtyCrc;
+  return true;
 }
 
 CCSDS::ResultBool CCSDS::Packet::setDataFieldHeader(const std::vector<uint8_t> &data, const std::string &headerType) {
   FORWARD_RESULT(m_dataField.setDataFieldHeader( data, headerType ));
-  m_updateStatus = false;
+  m_dirty |= kDirtyPrimaryHeader | kDirtyCrc;
   return true;
 }
 
 CCSDS::ResultBool CCSDS::Packet::setDataFieldHeader(const std::uint8_t *pData, const size_t sizeData,
                                                     const std::string &headerType) {
   FORWARD_RESULT(m_dataField.setDataFieldHeader( pData, sizeData, headerType ));
-  m_updateStatus = false;
+  m_dirty |= kDirtyPrimaryHeader | kDirtyCrc;
   return true;
 }
 
 CCSDS::ResultBool CCSDS::Packet::setDataFieldHeader(const std::vector<uint8_t> &data) {
   FORWARD_RESULT(m_dataField.setDataFieldHeader( data ));
-  m_updateStatus = false;
+  m_dirty |= kDirtyPrimaryHeader | kDirtyCrc;
   return true;
 }
 
 CCSDS::ResultBool CCSDS::Packet::setDataFieldHeader(const std::uint8_t *pData, const size_t sizeData) {
   FORWARD_RESULT(m_dataField.setDataFieldHeader( pData,sizeData ));
-  m_updateStatus = false;
+  m_dirty |= kDirtyPrimaryHeader | kDirtyCrc;
   return true;;
 }
 
 CCSDS::ResultBool CCSDS::Packet::setApplicationData(const std::vector<std::uint8_t> &data) {
   FORWARD_RESULT(m_dataField.setApplicationData( data ));
-  m_updateStatus = false;
+  m_dirty = kDirtyAll;
   return true;
 }
 
 CCSDS::ResultBool CCSDS::Packet::setApplicationData(const std::uint8_t *pData, const size_t sizeData) {
   FORWARD_RESULT(m_dataField.setApplicationData( pData,sizeData ));
-  m_updateStatus = false;
+  m_dirty = kDirtyAll;
+  return true;
+}
+
+CCSDS::ResultBool CCSDS::Packet::appendApplicationData(const std::uint8_t *pData, const size_t sizeData) {
+  FORWARD_RESULT(m_dataField.appendApplicationData( pData, sizeData ));
+  if (!(m_dirty & kDirtyApplicationCrc)) {
+    m_applicationDataCrc.append(pData, sizeData);
+  }
+  m_dirty |= kDirtyPrimaryHeader | kDirtyCrc;
   return true;
 }
 
+CCSDS::ResultBool CCSDS::Packet::patchApplicationData(const size_t offset, const std::uint8_t *pData,
+                                                      const size_t sizeData) {
+  const auto &applicationData = m_dataField.getApplicationDataReference();
+  RET_IF_ERR_MSG(!pData, ErrorCode::NULL_POINTER, "Application data is nullptr");
+  RET_IF_ERR_MSG(offset > applicationData.size() || sizeData > applicationData.size() - offset,
+                 ErrorCode::INVALID_APPLICATION_DATA, "Application data patch exceeds the application data");
+  // the CRC is patched with the bytes being replaced, before they are overwritten.
+  if (!(m_dirty & kDirtyApplicationCrc) &&
+      !m_applicationDataCrc.patch(offset, applicationData.data() + offset, pData, sizeData)) {
+    m_dirty |= kDirtyApplicationCrc;
+  }
+  FORWARD_RESULT(m_dataField.patchApplicationData( offset, pData, sizeData ));
+  m_dirty |= kDirtyCrc;
+  return true;
+}
+
+void CCSDS::Packet::clear() {
+  m_primaryHeader = {};
+  m_dataField.clear();
+  m_CRC16 = 0;
+  m_applicationDataCrc.reset();
+  m_CRC16Config = {};
+  m_dirty = kDirtyAll;
+  m_enableUpdatePacket = true;
+  m_sequenceCounter = 0;
+}
+
 void CCSDS::Packet::setSequenceFlags(const ESequenceFlag flags) {
   m_primaryHeader.setSequenceFlags(flags);
-  m_updateStatus = false;
+  m_dirty |= kDirtyPrimaryHeader;
 }
 
 CCSDS::ResultBool CCSDS::Packet::setSequenceCount(const std::uint16_t count) {
   RET_IF_ERR_MSG(m_primaryHeader.getSequenceFlags() == UNSEGMENTED && count != 0, ErrorCode::INVALID_DATA,
                  "Unable to set non 0 value for UNSEGMENTED packet");
   m_sequenceCounter = count;
-  m_updateStatus = false;
+  m_dirty |= kDirtyPrimaryHeader;
   return true;
 }
 
@@ -0,0 +1,108 @@
+// Copyright 2025-2026 ExoSpaceLabs
+// SPDX-License-Identifier: Apache-2.0
+
+#include "CCSDSPacketIndex.h"
+
+namespace {
+  constexpr std::uint16_t kSequenceCountMask = 0x3FFF;
+  constexpr std::size_t kApidCount = 2048;
+}
+
+void CCSDS::PacketIndex::clear() {
+  m_identification.clear();
+  m_sequenceControl.clear();
+  m_dataLength.clear();
+  m_offset.clear();
+}
+
+void CCSDS::PacketIndex::reserve(const std::size_t rows) {
+  m_identification.reserve(rows);
+  m_sequenceControl.reserve(rows);
+  m_dataLength.reserve(rows);
+  m_offset.reserve(rows);
+}
+
+void CCSDS::PacketIndex::add(const PacketView &view, const std::uint64_t offset) {
+  const auto header = view.getPrimaryHeaderBytes();
+  m_identification.push_back(static_cast<std::uint16_t>(header[0] << 8 | header[1]));
+  m_sequenceControl.push_back(static_cast<std::uint16_t>(header[2] << 8 | header[3]));
+  m_dataLength.push_back(static_cast<std::uint16_t>(header[4] << 8 | header[5]));
+  m_offset.push_back(offset);
+}
+
+void CCSDS::PacketIndex::add(const std::uint8_t *pData, const PacketView *views, const std::size_t count) {
+  const std::size_t first = m_offset.size();
+  m_offset.resize(first + count);
+  for (std::size_t row = 0; row < count; ++row) {
+    m_offset[first + row] = static_cast<std::uint64_t>(views[row].getBytes().data - pData);
+  }
+  decodeRows(pData, first, count);
+}
+
+void CCSDS::PacketIndex::add(const std::uint8_t *pData, const std::uint64_t *offsets, const std::size_t count) {
+  const std::size_t first = m_offset.size();
+  m_offset.insert(m_offset.end(), offsets, offsets + count);
+  decodeRows(pData, first, count);
+}
+
+void CCSDS::PacketIndex::decodeRows(const std::uint8_t *pData, const std::size_t first, const std::size_t count) {
+  m_identification.resize(first + count);
+  m_sequenceControl.resize(first + count);
+  m_dataLength.resize(first + count);
+  decodePrimaryHeaders(pData, m_offset.data() + first, count, m_identification.data() + first,
+                       m_sequenceControl.data() + first, m_dataLength.data() + first);
+}
+
+std::size_t CCSDS::PacketIndex::countAPID(const std::uint16_t apid) const {
+  // branch free so the loop is vectorized.
+  std::size_t count = 0;
+  const std::uint16_t *identification = m_identification.data();
+  for (std::size_t row = 0; row < m_identification.size(); ++row) {
+    count += (identification[row] & 0x07FF) == apid;
+  }
+  return count;
+}
+
+std::vector<std::size_t> CCSDS::PacketIndex::selectAPID(const std::uint16_t apid) const {
+  std::vector<std::size_t> rows;
+  rows.reserve(countAPID(apid));
+  for (std::size_t row = 0; row < m_identification.size(); ++row) {
+    if ((m_identification[row] & 0x07FF) == apid) {
+      rows.push_back(row);
+    }
+  }
+  return rows;
+}
+
+std::vector<std::size_t> CCSDS::PacketIndex::findSequenceGaps(const std::uint16_t apid) const {
+  std::vector<std::size_t> rows;
+  bool first = true;
+  std::uint16_t previous = 0;
+  for (std::size_t row = 0; row < m_identification.size(); ++row) {
+    if ((m_identification[row] & 0x07FF) != apid) {
+      continue;
+    }
+    const std::uint16_t count = m_sequenceControl[row] & kSequenceCountMask;
+    if (!first && count != ((previous + 1) & kSequenceCountMask)) {
+      rows.push_back(row);
+    }
+    previous = count;
+    first = false;
+  }
+  return rows;
+}
+
+std::vector<std::size_t> CCSDS::PacketIndex::findSequenceGaps() const {
+  // previous sequence count per APID, -1 until the APID is first seen.
+  std::vector<std::int32_t> previous(kApidCount, -1);
+  std::vector<std::size_t> rows;
+  for (std::size_t row = 0; row < m_identification.size(); ++row) {
+    auto &last = previous[m_identification[row] & 0x07FF];
+    const std::int32_t count = m_sequenceControl[row] & kSequenceCountMask;
+    if (last >= 0 && count != ((last + 1) & kSequenceCountMask)) {
+      rows.push_back(row);
+    }
+    last = count;
+  }
+  return rows;
+}
@@ -0,0 +1,47 @@
+// Copyright 2025-2026 ExoSpaceLabs
+// SPDX-License-Identifier: Apache-2.0
+
+#include "CCSDSPacketView.h"
+
+CCSDS::ResultBool CCSDS::PacketView::deserialize(const std::uint8_t *pData, const std::size_t sizeData,
+                                                 const std::uint16_t secondaryHeaderSize) {
+  RET_IF_ERR_MSG(!pData, ErrorCode::NULL_POINTER, "Cannot view Packet, data is nullptr");
+  RET_IF_ERR_MSG(sizeData < 8, ErrorCode::INVALID_HEADER_DATA,
+                 "Cannot view Packet, Invalid Data provided data size must be at least 8 bytes");
+  RET_IF_ERR_MSG(secondaryHeaderSize > sizeData - 8, ErrorCode::INVALID_SECONDARY_HEADER_DATA,
+                 "Cannot view Packet, secondary header exceeds the data field size");
+  m_data = pData;
+  m_size = sizeData;
+  m_secondaryHeaderSize = secondaryHeaderSize;
+  return true;
+}
+
+CCSDS::ResultBool CCSDS::PacketView::deserialize(const std::vector<std::uint8_t> &data,
+                                                 const std::uint16_t secondaryHeaderSize) {
+  FORWARD_RESULT(deserialize(data.data(), data.size(), secondaryHeaderSize));
+  return true;
+}
+
+std::uint64_t CCSDS::PacketView::getPrimaryHeader64bit() const {
+  std::uint64_t headerData = 0;
+  for (std::uint8_t i = 0; i < 6; ++i) {
+    headerData |= static_cast<std::uint64_t>(m_data[i]) << (40 - i * 8); // Combine MSB to LSB
+  }
+  return headerData;
+}
+
+CCSDS::Header CCSDS::PacketView::getPrimaryHeader() const {
+  Header header;
+  header.setData(decodePrimaryHeader(m_data));
+  return header;
+}
+
+std::uint16_t CCSDS::PacketView::computeCRC(const CRC16Config &config) const {
+  const auto dataField = getFullDataFieldBytes();
+  return CRC16Engine::get(config.polynomial).compute(dataField.data, dataField.size, config.initialValue) ^
+         config.finalXorValue;
+}
+
+CCSDS::BufferView CCSDS::PacketView::getApplicationData() const {
+  return {m_data + 6 + m_secondaryHeaderSize, m_size - 8 - m_secondaryHeaderSize};
+}
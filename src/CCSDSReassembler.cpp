@@ -0,0 +1,156 @@
+// Copyright 2025-2026 ExoSpaceLabs
+// SPDX-License-Identifier: Apache-2.0
+
+#include "CCSDSReassembler.h"
+#include "CCSDSHeader.h"
+
+namespace {
+  constexpr std::uint16_t kSequenceCountMask = 0x3FFF;
+}
+
+CCSDS::ResultBool CCSDS::Reassembler::add(const PacketView &packet, const std::uint64_t now) {
+  RET_IF_ERR_MSG(!packet.isValid(), ErrorCode::NO_DATA, "Cannot reassemble, the packet view is empty.");
+  const auto applicationData = packet.getApplicationData();
+  FORWARD_RESULT(add(packet.getAPID(), packet.getSequenceFlags(), packet.getSequenceCount(), applicationData.data,
+                     applicationData.size, now));
+  return true;
+}
+
+CCSDS::ResultBool CCSDS::Reassembler::add(const std::uint16_t apid, const std::uint8_t sequenceFlags,
+                                          const std::uint16_t sequenceCount, const std::uint8_t *pData,
+                                          const std::size_t sizeData, const std::uint64_t now) {
+  RET_IF_ERR_MSG(!m_sink, ErrorCode::NULL_POINTER, "Cannot reassemble, sink is not set.");
+  RET_IF_ERR_MSG(!pData && sizeData != 0, ErrorCode::NULL_POINTER, "Cannot reassemble, data is nullptr.");
+  Stream &stream = m_streams[apid];
+
+  if (stream.inProgress && m_timeout != 0 && now - stream.lastUpdate > m_timeout) {
+    discard(stream);
+    increment(stream, &ReassemblyStatistics::timedOutUnits);
+  }
+
+  if (sequenceFlags == UNSEGMENTED || sequenceFlags == FIRST_SEGMENT) {
+    if (stream.inProgress) {
+      discard(stream); // interrupted, the unit never received its last segment.
+    }
+    if (sequenceFlags == UNSEGMENTED) {
+      deliver(apid, stream, pData, sizeData);
+      return true;
+    }
+    stream.inProgress = true;
+    m_pendingUnits++;
+  } else if (!stream.inProgress) {
+    increment(stream, &ReassemblyStatistics::droppedSegments); // the unit it belongs to was already dropped.
+    return true;
+  } else if (sequenceCount == stream.lastSequenceCount) {
+    increment(stream, &ReassemblyStatistics::duplicateSegments);
+    return true;
+  } else if (sequenceCount != ((stream.lastSequenceCount + 1) & kSequenceCountMask)) {
+    discard(stream);
+    increment(stream, &ReassemblyStatistics::droppedSegments);
+    return true;
+  }
+
+  if (stream.buffer.size() + sizeData > m_maxUnitSize) {
+    discard(stream);
+    increment(stream, &ReassemblyStatistics::droppedSegments);
+    increment(stream, &ReassemblyStatistics::overflowUnits);
+    return true;
+  }
+  if (m_bufferedBytes + sizeData > m_memoryLimit) {
+    makeRoom(stream, sizeData);
+    if (m_bufferedBytes + sizeData > m_memoryLimit) {
+      discard(stream);
+      increment(stream, &ReassemblyStatistics::droppedSegments);
+      increment(stream, &ReassemblyStatistics::overflowUnits);
+      return true;
+    }
+  }
+
+  stream.buffer.insert(stream.buffer.end(), pData, pData + sizeData);
+  m_bufferedBytes += sizeData;
+  stream.segments++;
+  stream.lastSequenceCount = sequenceCount;
+  stream.lastUpdate = now;
+
+  if (sequenceFlags == LAST_SEGMENT) {
+    m_bufferedBytes -= stream.buffer.size();
+    m_pendingUnits--;
+    stream.inProgress = false;
+    stream.segments = 0;
+    deliver(apid, stream, stream.buffer.data(), stream.buffer.size());
+    stream.buffer.clear();
+  }
+  return true;
+}
+
+void CCSDS::Reassembler::expire(const std::uint64_t now) {
+  if (m_timeout == 0) {
+    return;
+  }
+  for (auto &[apid, stream] : m_streams) {
+    if (stream.inProgress && now - stream.lastUpdate > m_timeout) {
+      discard(stream);
+      increment(stream, &ReassemblyStatistics::timedOutUnits);
+    }
+  }
+}
+
+void CCSDS::Reassembler::drop(const std::uint16_t apid) {
+  if (const auto it = m_streams.find(apid); it != m_streams.end() && it->second.inProgress) {
+    discard(it->second);
+  }
+}
+
+void CCSDS::Reassembler::flush() {
+  for (auto &[apid, stream] : m_streams) {
+    if (stream.inProgress) {
+      discard(stream);
+    }
+  }
+}
+
+CCSDS::ReassemblyStatistics CCSDS::Reassembler::getStatistics(const std::uint16_t apid) const {
+  if (const auto it = m_streams.find(apid); it != m_streams.end()) {
+    return it->second.statistics;
+  }
+  return {};
+}
+
+void CCSDS::Reassembler::increment(Stream &stream, std::uint64_t ReassemblyStatistics::*counter,
+                                   const std::uint64_t value) {
+  stream.statistics.*counter += value;
+  m_statistics.*counter += value;
+}
+
+void CCSDS::Reassembler::discard(Stream &stream) {
+  increment(stream, &ReassemblyStatistics::droppedSegments, stream.segments);
+  m_bufferedBytes -= stream.buffer.size();
+  m_pendingUnits--;
+  stream.buffer.clear();
+  stream.segments = 0;
+  stream.inProgress = false;
+}
+
+void CCSDS::Reassembler::deliver(const std::uint16_t apid, Stream &stream, const std::uint8_t *pData,
+                                 const std::size_t sizeData) {
+  m_sink(apid, pData, sizeData);
+  increment(stream, &ReassemblyStatistics::completedUnits);
+  increment(stream, &ReassemblyStatistics::completedBytes, sizeData);
+}
+
+void CCSDS::Reassembler::makeRoom(const Stream &keep, const std::size_t sizeData) {
+  while (m_bufferedBytes + sizeData > m_memoryLimit) {
+    Stream *oldest = nullptr;
+    for (auto &[apid, stream] : m_streams) {
+      if (&stream != &keep && stream.inProgress && !stream.buffer.empty() &&
+          (oldest == nullptr || stream.lastUpdate < oldest->lastUpdate)) {
+        oldest = &stream;
+      }
+    }
+    if (oldest == nullptr) {
+      return;
+    }
+    discard(*oldest);
+    increment(*oldest, &ReassemblyStatistics::overflowUnits);
+  }
+}
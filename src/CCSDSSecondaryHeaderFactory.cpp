@@ -0,0 +1,20 @@
+// Copyright 2025-2026 ExoSpaceLabs
+// SPDX-License-Identifier: Apache-2.0
+
+#include "CCSDSSecondaryHeaderFactory.h"
+#include "PusServices.h"
+
+CCSDS::SecondaryHeaderFactory &CCSDS::SecondaryHeaderFactory::instance() {
+  // built once on first use, the registration order gives the built-in headers their SecondaryHeaderTypeId.
+  static SecondaryHeaderFactory factory;
+  static const bool builtInsRegistered = [] {
+    bool noError = true;
+    noError &= factory.registerType<BufferHeader>().has_value();
+    noError &= factory.registerType<PusA>().has_value();
+    noError &= factory.registerType<PusB>().has_value();
+    noError &= factory.registerType<PusC>().has_value();
+    return noError;
+  }();
+  (void) builtInsRegistered;
+  return factory;
+}
@@ -0,0 +1,314 @@
+// Copyright 2025-2026 ExoSpaceLabs
+// SPDX-License-Identifier: Apache-2.0
+
+#include "CCSDSStreamDecoder.h"
+#include <algorithm>
+#include <cstring>
+
+//exclude includes when building for MCU
+#ifndef CCSDS_MCU
+  // vectorized sync pattern search, SSE2 is part of x86-64, AVX2 is selected at runtime.
+  #if (defined(__GNUC__) || defined(__clang__)) && defined(__x86_64__)
+    #define CCSDS_SYNC_SEARCH_X86 1
+    #include <immintrin.h>
+  #elif (defined(__GNUC__) || defined(__clang__)) && defined(__aarch64__)
+    #define CCSDS_SYNC_SEARCH_NEON 1
+    #include <arm_neon.h>
+  #endif
+#endif //CCSDS_MCU
+
+namespace {
+  /** @brief reads the packet size (header + data field + CRC) from the primary header at pData. */
+  size_t packetSizeFromHeader(const std::uint8_t *pData) {
+    return ((static_cast<size_t>(pData[4]) << 8) | pData[5]) + 8;
+  }
+
+  /** @brief scalar search, memchr locates the first pattern byte and the remaining three are compared. */
+  size_t findSyncPatternScalar(const std::uint8_t *pData, const size_t sizeData, const std::uint8_t *pattern,
+                               size_t offset) {
+    while (offset + 4 <= sizeData) {
+      const auto *candidate = static_cast<const std::uint8_t *>(std::memchr(pData + offset, pattern[0],
+                                                                            sizeData - offset - 3));
+      if (candidate == nullptr) {
+        break;
+      }
+      offset = static_cast<size_t>(candidate - pData);
+      if (std::memcmp(candidate + 1, pattern + 1, 3) == 0) {
+        return offset;
+      }
+      offset++;
+    }
+    return sizeData;
+  }
+
+#ifdef CCSDS_SYNC_SEARCH_X86
+  bool avx2Supported() {
+    static const bool supported = [] {
+      __builtin_cpu_init();
+      return __builtin_cpu_supports("avx2");
+    }();
+    return supported;
+  }
+
+  /** @brief compares 32 positions per iteration, bit i of the mask is set when the pattern starts at offset + i. */
+  __attribute__((target("avx2")))
+  size_t findSyncPatternAvx2(const std::uint8_t *pData, const size_t sizeData, const std::uint8_t *pattern,
+                             size_t &offset) {
+    const __m256i b0 = _mm256_set1_epi8(static_cast<char>(pattern[0]));
+    const __m256i b1 = _mm256_set1_epi8(static_cast<char>(pattern[1]));
+    const __m256i b2 = _mm256_set1_epi8(static_cast<char>(pattern[2]));
+    const __m256i b3 = _mm256_set1_epi8(static_cast<char>(pattern[3]));
+    for (; offset + 32 + 3 <= sizeData; offset += 32) {
+      const std::uint8_t *p = pData + offset;
+      const __m256i eq01 = _mm256_and_si256(
+          _mm256_cmpeq_epi8(_mm256_loadu_si256(reinterpret_cast<const __m256i *>(p)), b0),
+          _mm256_cmpeq_epi8(_mm256_loadu_si256(reinterpret_cast<const __m256i *>(p + 1)), b1));
+      const __m256i eq23 = _mm256_and_si256(
+          _mm256_cmpeq_epi8(_mm256_loadu_si256(reinterpret_cast<const __m256i *>(p + 2)), b2),
+          _mm256_cmpeq_epi8(_mm256_loadu_si256(reinterpret_cast<const __m256i *>(p + 3)), b3));
+      const auto mask = static_cast<std::uint32_t>(_mm256_movemask_epi8(_mm256_and_si256(eq01, eq23)));
+      if (mask != 0) {
+        return offset + static_cast<size_t>(__builtin_ctz(mask));
+      }
+    }
+    return sizeData;
+  }
+
+  /** @brief SSE2 variant of findSyncPatternAvx2, 16 positions per iteration. */
+  size_t findSyncPatternSse2(const std::uint8_t *pData, const size_t sizeData, const std::uint8_t *pattern,
+                             size_t &offset) {
+    const __m128i b0 = _mm_set1_epi8(static_cast<char>(pattern[0]));
+    const __m128i b1 = _mm_set1_epi8(static_cast<char>(pattern[1]));
+    const __m128i b2 = _mm_set1_epi8(static_cast<char>(pattern[2]));
+    const __m128i b3 = _mm_set1_epi8(static_cast<char>(pattern[3]));
+    for (; offset + 16 + 3 <= sizeData; offset += 16) {
+      const std::uint8_t *p = pData + offset;
+      const __m128i eq01 = _mm_and_si128(_mm_cmpeq_epi8(_mm_loadu_si128(reinterpret_cast<const __m128i *>(p)), b0),
+                                         _mm_cmpeq_epi8(_mm_loadu_si128(reinterpret_cast<const __m128i *>(p + 1)), b1));
+      const __m128i eq23 = _mm_and_si128(_mm_cmpeq_epi8(_mm_loadu_si128(reinterpret_cast<const __m128i *>(p + 2)), b2),
+                                         _mm_cmpeq_epi8(_mm_loadu_si128(reinterpret_cast<const __m128i *>(p + 3)), b3));
+      const auto mask = static_cast<std::uint32_t>(_mm_movemask_epi8(_mm_and_si128(eq01, eq23)));
+      if (mask != 0) {
+        return offset + static_cast<size_t>(__builtin_ctz(mask));
+      }
+    }
+    return sizeData;
+  }
+#endif
+
+#ifdef CCSDS_SYNC_SEARCH_NEON
+  /** @brief NEON variant of the x86 kernels, the byte mask is narrowed to 4 bits per position. */
+  size_t findSyncPatternNeon(const std::uint8_t *pData, const size_t sizeData, const std::uint8_t *pattern,
+                             size_t &offset) {
+    const uint8x16_t b0 = vdupq_n_u8(pattern[0]);
+    const uint8x16_t b1 = vdupq_n_u8(pattern[1]);
+    const uint8x16_t b2 = vdupq_n_u8(pattern[2]);
+    const uint8x16_t b3 = vdupq_n_u8(pattern[3]);
+    for (; offset + 16 + 3 <= sizeData; offset += 16) {
+      const std::uint8_t *p = pData + offset;
+      const uint8x16_t eq = vandq_u8(vandq_u8(vceqq_u8(vld1q_u8(p), b0), vceqq_u8(vld1q_u8(p + 1), b1)),
+                                     vandq_u8(vceqq_u8(vld1q_u8(p + 2), b2), vceqq_u8(vld1q_u8(p + 3), b3)));
+      const std::uint64_t mask = vget_lane_u64(vreinterpret_u64_u8(vshrn_n_u16(vreinterpretq_u16_u8(eq), 4)), 0);
+      if (mask != 0) {
+        return offset + static_cast<size_t>(__builtin_ctzll(mask) >> 2);
+      }
+    }
+    return sizeData;
+  }
+#endif
+}
+
+size_t CCSDS::StreamDecoder::findSyncPattern(const std::uint8_t *pData, const size_t sizeData,
+                                             const std::uint32_t syncPattern) {
+  if (pData == nullptr || sizeData < 4) {
+    return sizeData;
+  }
+  const std::uint8_t pattern[4] = {static_cast<std::uint8_t>(syncPattern >> 24),
+                                   static_cast<std::uint8_t>(syncPattern >> 16),
+                                   static_cast<std::uint8_t>(syncPattern >> 8),
+                                   static_cast<std::uint8_t>(syncPattern)};
+  size_t offset = 0;
+#if defined(CCSDS_SYNC_SEARCH_X86)
+  const size_t found = avx2Supported() ? findSyncPatternAvx2(pData, sizeData, pattern, offset)
+                                       : findSyncPatternSse2(pData, sizeData, pattern, offset);
+  if (found != sizeData) {
+    return found;
+  }
+#elif defined(CCSDS_SYNC_SEARCH_NEON)
+  const size_t found = findSyncPatternNeon(pData, sizeData, pattern, offset);
+  if (found != sizeData) {
+    return found;
+  }
+#endif
+  // tail not covered by a full vector, or the whole buffer without SIMD support.
+  return findSyncPatternScalar(pData, sizeData, pattern, offset);
+}
+
+void CCSDS::StreamDecoder::push(const std::uint8_t *pData, const size_t sizeData) {
+  stashInput();
+  m_input = pData;
+  m_inputSize = pData ? sizeData : 0;
+  m_inputOffset = 0;
+}
+
+CCSDS::Result<bool> CCSDS::StreamDecoder::next(PacketView &view) {
+  if (m_carryReturned) {
+    m_carry.clear(); // keeps capacity, the carry-over buffer is allocated once.
+    m_carryReturned = false;
+  }
+  const size_t prefixSize = getPrefixSize();
+
+  while (true) {
+    // complete the packet straddling the previous chunk first.
+    if (!m_carry.empty()) {
+      if (!fillCarry(prefixSize + 6)) {
+        return false;
+      }
+      if (!syncPatternMatches(m_carry.data())) {
+        RET_IF_ERR_MSG(!m_resyncEnable, ErrorCode::INVALID_DATA, "Sync Pattern mismatch.");
+        resyncCarry();
+        continue;
+      }
+      const size_t packetSize = packetSizeFromHeader(m_carry.data() + prefixSize);
+      if (!fillCarry(prefixSize + packetSize)) {
+        return false;
+      }
+      FORWARD_RESULT(view.deserialize(m_carry.data() + prefixSize, packetSize));
+      m_carryReturned = true;
+      m_skipping = false;
+      m_packetCount++;
+      return true;
+    }
+
+    const size_t remaining = m_inputSize - m_inputOffset;
+    if (remaining == 0) {
+      return false;
+    }
+    const std::uint8_t *pData = m_input + m_inputOffset;
+    if (remaining < prefixSize + 6) {
+      stashInput();
+      return false;
+    }
+    if (!syncPatternMatches(pData)) {
+      RET_IF_ERR_MSG(!m_resyncEnable, ErrorCode::INVALID_DATA, "Sync Pattern mismatch.");
+      resyncInput();
+      continue;
+    }
+    const size_t packetSize = packetSizeFromHeader(pData + prefixSize);
+    if (remaining < prefixSize + packetSize) {
+      stashInput();
+      return false;
+    }
+    FORWARD_RESULT(view.deserialize(pData + prefixSize, packetSize));
+    m_inputOffset += prefixSize + packetSize;
+    m_skipping = false;
+    m_packetCount++;
+    return true;
+  }
+}
+
+size_t CCSDS::StreamDecoder::getBufferedBytes() const {
+  return (m_carryReturned ? 0 : m_carry.size()) + (m_inputSize - m_inputOffset);
+}
+
+void CCSDS::StreamDecoder::skipBuffered() {
+  skip(getBufferedBytes());
+  m_carry.clear();
+  m_carryReturned = false;
+  m_inputOffset = m_inputSize;
+}
+
+void CCSDS::StreamDecoder::reset() {
+  m_input = nullptr;
+  m_inputSize = 0;
+  m_inputOffset = 0;
+  m_carry.clear();
+  m_carryReturned = false;
+  m_skipping = false;
+  m_packetCount = 0;
+  m_skippedRegions = 0;
+  m_skippedBytes = 0;
+}
+
+bool CCSDS::StreamDecoder::syncPatternMatches(const std::uint8_t *pData) const {
+  if (!m_syncPattEnable) {
+    return true;
+  }
+  const std::uint32_t value = (static_cast<std::uint32_t>(pData[0]) << 24) |
+                              (static_cast<std::uint32_t>(pData[1]) << 16) |
+                              (static_cast<std::uint32_t>(pData[2]) << 8) |
+                              (static_cast<std::uint32_t>(pData[3]));
+  return value == m_syncPattern;
+}
+
+bool CCSDS::StreamDecoder::fillCarry(const size_t size) {
+  if (m_carry.size() < size) {
+    const size_t toCopy = std::min(size - m_carry.size(), m_inputSize - m_inputOffset);
+    m_carry.insert(m_carry.end(), m_input + m_inputOffset, m_input + m_inputOffset + toCopy);
+    m_inputOffset += toCopy;
+  }
+  return m_carry.size() >= size;
+}
+
+void CCSDS::StreamDecoder::stashInput() {
+  if (m_carryReturned) {
+    m_carry.clear();
+    m_carryReturned = false;
+  }
+  if (m_inputOffset < m_inputSize) {
+    m_carry.insert(m_carry.end(), m_input + m_inputOffset, m_input + m_inputSize);
+  }
+  m_input = nullptr;
+  m_inputSize = 0;
+  m_inputOffset = 0;
+}
+
+std::uint8_t CCSDS::StreamDecoder::pendingByte(const size_t index) const {
+  return index < m_carry.size() ? m_carry[index] : m_input[m_inputOffset + index - m_carry.size()];
+}
+
+void CCSDS::StreamDecoder::skip(const size_t size) {
+  if (size == 0) {
+    return;
+  }
+  if (!m_skipping) {
+    m_skipping = true;
+    m_skippedRegions++;
+  }
+  m_skippedBytes += size;
+}
+
+void CCSDS::StreamDecoder::resyncCarry() {
+  // position 0 is known not to match, complete matches inside the carry are searched first.
+  const size_t carrySize = m_carry.size();
+  size_t position = 1 + findSyncPattern(m_carry.data() + 1, carrySize - 1, m_syncPattern);
+  if (position == carrySize) {
+    // a pattern may straddle the carry and the pushed chunk, or be completed by a later chunk.
+    const size_t pendingSize = carrySize + (m_inputSize - m_inputOffset);
+    for (position = carrySize - 3; position < carrySize; ++position) { // the carry holds at least a full prefix.
+      if (position + 4 > pendingSize) {
+        break;
+      }
+      const std::uint32_t value = (static_cast<std::uint32_t>(pendingByte(position)) << 24) |
+                                  (static_cast<std::uint32_t>(pendingByte(position + 1)) << 16) |
+                                  (static_cast<std::uint32_t>(pendingByte(position + 2)) << 8) |
+                                  (static_cast<std::uint32_t>(pendingByte(position + 3)));
+      if (value == m_syncPattern) {
+        break;
+      }
+    }
+  }
+  skip(position);
+  m_carry.erase(m_carry.begin(), m_carry.begin() + static_cast<std::ptrdiff_t>(position));
+}
+
+void CCSDS::StreamDecoder::resyncInput() {
+  // position 0 is known not to match, without a match the last 3 bytes are kept as a possible partial pattern.
+  const size_t remaining = m_inputSize - m_inputOffset;
+  size_t position = 1 + findSyncPattern(m_input + m_inputOffset + 1, remaining - 1, m_syncPattern);
+  if (position == remaining) {
+    position = remaining - 3;
+  }
+  skip(position);
+  m_inputOffset += position;
+}
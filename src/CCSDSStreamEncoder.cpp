@@ -0,0 +1,88 @@
+// Copyright 2025-2026 ExoSpaceLabs
+// SPDX-License-Identifier: Apache-2.0
+
+#include "CCSDSStreamEncoder.h"
+#include <algorithm>
+
+CCSDS::ResultBool CCSDS::StreamEncoder::setTemplate(const Packet &templatePacket) {
+  const auto maxBytesPerPacket = templatePacket.getDataFieldMaximumSize();
+  RET_IF_ERR_MSG(maxBytesPerPacket == 0, ErrorCode::INVALID_APPLICATION_DATA,
+                 "Cannot set template, the template leaves no room for application data");
+  m_templatePacket = templatePacket;
+  m_templatePacket.setUpdatePacketEnable(true);
+  Packet probe = m_templatePacket;
+  m_concurrent = probe.detachSecondaryHeader();
+  m_maxBytesPerPacket = maxBytesPerPacket;
+  // 6 bytes for the primary header and 2 bytes for the CRC16.
+  m_packetOverhead = static_cast<std::uint16_t>(8 + m_templatePacket.getDataField().getDataFieldHeaderBytesSize());
+  m_templateIsSet = true;
+  return true;
+}
+
+CCSDS::ResultBool CCSDS::StreamEncoder::begin(const std::uint64_t sizeData, const std::uint16_t sequenceCount) {
+  RET_IF_ERR_MSG(!m_templateIsSet, ErrorCode::INVALID_HEADER_DATA, "Cannot begin stream, No template has been set");
+  RET_IF_ERR_MSG(sizeData == 0, ErrorCode::NO_DATA, "Cannot begin stream, Provided data is empty");
+  m_sizeData = sizeData;
+  m_sequenceCount = sequenceCount;
+  return true;
+}
+
+std::uint64_t CCSDS::StreamEncoder::getPacketCount() const {
+  if (m_maxBytesPerPacket == 0) {
+    return 0;
+  }
+  return (m_sizeData + m_maxBytesPerPacket - 1) / m_maxBytesPerPacket;
+}
+
+std::uint64_t CCSDS::StreamEncoder::getEncodedSize(const std::uint64_t offset, const std::uint64_t sizeData) const {
+  if (m_maxBytesPerPacket == 0 || offset >= m_sizeData) {
+    return 0;
+  }
+  const std::uint64_t size = std::min(sizeData, m_sizeData - offset);
+  const std::uint64_t packets = (size + m_maxBytesPerPacket - 1) / m_maxBytesPerPacket;
+  return size + packets * (m_packetOverhead + (m_syncPattEnable ? 4 : 0));
+}
+
+CCSDS::ResultBool CCSDS::StreamEncoder::encode(const std::uint64_t offset, const std::uint8_t *pData,
+                                               const std::size_t sizeData, std::vector<std::uint8_t> &buffer) const {
+  RET_IF_ERR_MSG(!m_templateIsSet || m_sizeData == 0, ErrorCode::INVALID_HEADER_DATA,
+                 "Cannot encode, the stream has not begun");
+  RET_IF_ERR_MSG(!pData && sizeData != 0, ErrorCode::NULL_POINTER, "Cannot encode, data is nullptr");
+  RET_IF_ERR_MSG(offset % m_maxBytesPerPacket != 0, ErrorCode::INVALID_DATA,
+                 "Cannot encode, chunk does not start on a packet boundary");
+  RET_IF_ERR_MSG(offset + sizeData > m_sizeData, ErrorCode::INVALID_DATA, "Cannot encode, chunk exceeds the stream");
+  RET_IF_ERR_MSG(offset + sizeData != m_sizeData && sizeData % m_maxBytesPerPacket != 0, ErrorCode::INVALID_DATA,
+                 "Cannot encode, chunk does not end on a packet boundary");
+
+  // the assignments from the template reuse the buffers of the packet across the chunk.
+  Packet packet;
+  const bool segmented = m_sizeData > m_maxBytesPerPacket;
+  const std::uint64_t lastIndex = getPacketCount() - 1;
+  std::uint64_t index = offset / m_maxBytesPerPacket;
+
+  std::size_t outputOffset = buffer.size();
+  buffer.resize(outputOffset + getEncodedSize(offset, sizeData));
+  for (std::size_t consumed = 0; consumed < sizeData; index++) {
+    const std::size_t size = std::min<std::size_t>(sizeData - consumed, m_maxBytesPerPacket);
+    packet = m_templatePacket;
+    packet.detachSecondaryHeader(); // the secondary header is updated per packet, not on the shared template one.
+    FORWARD_RESULT(packet.setApplicationData(pData + consumed, size));
+    if (segmented) {
+      // same flags and counts as Manager::planSegments(), the first segment counts from 1 after the preceding count.
+      packet.setSequenceFlags(index == 0 ? FIRST_SEGMENT : index == lastIndex ? LAST_SEGMENT : CONTINUING_SEGMENT);
+      FORWARD_RESULT(packet.setSequenceCount(static_cast<std::uint16_t>(m_sequenceCount + 1 + index)));
+    }
+    if (m_syncPattEnable) {
+      buffer[outputOffset++] = m_syncPattern >> 24 & 0xff;
+      buffer[outputOffset++] = m_syncPattern >> 16 & 0xff;
+      buffer[outputOffset++] = m_syncPattern >> 8 & 0xff;
+      buffer[outputOffset++] = m_syncPattern & 0xff;
+    }
+    std::size_t written{0};
+    ASSIGN_CP(written, packet.serializeInto(buffer.data() + outputOffset, buffer.size() - outputOffset));
+    outputOffset += written;
+    consumed += size;
+  }
+  buffer.resize(outputOffset);
+  return true;
+}
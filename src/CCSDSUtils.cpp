@@ -9,6 +9,7 @@
 #ifndef CCSDS_MCU
   #include <fstream>
   #include <iostream>
+  #include <sys/stat.h>
 #else
   #include <string>
 #endif //CCSDS_MCU
@@ -20,22 +21,14 @@
 uint16_t crc16(
   const std::vector<std::uint8_t> &data, const std::uint16_t polynomial, const std::uint16_t initialValue,
   const std::uint16_t finalXorValue) {
-  std::uint16_t crc = initialValue;
-
-  for (const auto &byte: data) {
-    crc ^= static_cast<std::uint16_t>(byte) << 8; // Align byte with MSB of 16-bit CRC
-    for (std::int32_t i = 0; i < 8; ++i) {
-      // Process each bit
-      if (crc & 0x8000) {
-        // Check if MSB is set
-        crc = (crc << 1) ^ polynomial; // Shift and XOR with polynomial
-      } else {
-        crc = crc << 1; // Shift only
-      }
-    }
-  }
+  return crc16(data.data(), data.size(), polynomial, initialValue, finalXorValue);
+}
 
-  return crc ^ finalXorValue; // Apply final XOR
+uint16_t crc16(
+  const std::uint8_t *pData, const size_t sizeData, const std::uint16_t polynomial, const std::uint16_t initialValue,
+  const std::uint16_t finalXorValue) {
+  const auto &engine = CCSDS::CRC16Engine::get(polynomial);
+  return engine.compute(pData, sizeData, initialValue) ^ finalXorValue; // Apply final XOR
 }
 
 bool stringEndsWith(const std::string& str, const std::string& suffix) {
@@ -238,10 +231,11 @@ CCSDS::ResultBuffer readBinaryFile(const std::string& filename) {
 }
 
 bool fileExists(const std::string &fileName) {
-  auto res = readBinaryFile(fileName);
-  if ( res.has_value()) {
-    return true;
+  // metadata only, the file content is not read.
+  struct stat fileStat{};
+  if (fileName.empty() || stat(fileName.c_str(), &fileStat) != 0) {
+    return false;
   }
-  return false;
+  return (fileStat.st_mode & S_IFMT) == S_IFREG;
 }
 #endif
@@ -3,63 +3,136 @@
 
 #include "CCSDSValidator.h"
 #include <CCSDSUtils.h>
+#include <algorithm>
 
-void CCSDS::Validator::configure(const bool validatePacketCoherence, bool validateSequenceCount, const bool validateAgainstTemplate) {
+//exclude includes when building for MCU
+#ifndef CCSDS_MCU
+  #include <thread>
+
+namespace {
+  constexpr size_t kMinPacketsPerThread = 64; ///< below this a thread costs more than the packets it checks.
+}
+#endif
+
+void CCSDS::Validator::configure(const bool validatePacketCoherence, const bool validateSequenceCount, const bool validateAgainstTemplate) {
   m_validatePacketCoherence = validatePacketCoherence;
+  m_validateSegmentedCount = validateSequenceCount;
   m_validateAgainstTemplate = validateAgainstTemplate;
 }
 
 bool CCSDS::Validator::validate(const Packet &packet) {
-  m_report.clear();
-  m_report.reserve(m_reportSize);
-  m_report.assign({true, true, true, true, true, true});
-  bool result{true};
   auto toValidate = packet;
   toValidate.setUpdatePacketEnable(false);
-  auto toValidateHeader = toValidate.getPrimaryHeader();
-  const auto toValidateHeaderData = toValidateHeader.serialize();
   // auto coherence checks
   const auto dataFieldBytes = toValidate.getFullDataFieldBytes();
-  const auto dataFieldBytesSize = dataFieldBytes.size();
+  const bool crcMatches = !m_validatePacketCoherence || crc16(dataFieldBytes) == toValidate.getCRC();
+  return validateHeader(toValidate.getPrimaryHeader(), dataFieldBytes.size(), crcMatches);
+}
+
+bool CCSDS::Validator::validate(const PacketView &packet) {
+  const auto dataField = packet.getFullDataFieldBytes();
+  const bool crcMatches = !m_validatePacketCoherence || crc16(dataField.data, dataField.size) == packet.getCRC();
+  return validateHeader(packet.getPrimaryHeader(), dataField.size, crcMatches);
+}
+
+bool CCSDS::Validator::validateAll(const PacketView *packets, const size_t count) {
+  m_reports.assign(count, {});
+  const Header templateHeader = getTemplateHeader();
+  auto checkRange = [&](const size_t first, const size_t last) {
+    for (size_t index = first; index < last; ++index) {
+      const PacketView &packet = packets[index];
+      const auto dataField = packet.getFullDataFieldBytes();
+      const bool crcMatches = !m_validatePacketCoherence || crc16(dataField.data, dataField.size) == packet.getCRC();
+      checkPacket(packet.getPrimaryHeader(), dataField.size, crcMatches, templateHeader, m_reports[index]);
+    }
+  };
+
+#ifndef CCSDS_MCU
+  std::uint32_t threadCount = m_threadCount == 0 ? std::thread::hardware_concurrency() : m_threadCount;
+  threadCount = static_cast<std::uint32_t>(std::min<size_t>(threadCount, count / kMinPacketsPerThread));
+  if (threadCount > 1) {
+    // each thread checks a contiguous range of packets and writes only the reports of that range.
+    std::vector<std::thread> workers;
+    workers.reserve(threadCount - 1);
+    for (std::uint32_t thread = 1; thread < threadCount; ++thread) {
+      workers.emplace_back(checkRange, count * thread / threadCount, count * (thread + 1) / threadCount);
+    }
+    checkRange(0, count / threadCount);
+    for (auto &worker : workers) {
+      worker.join();
+    }
+  } else {
+    checkRange(0, count);
+  }
+#else
+  checkRange(0, count);
+#endif
+
+  // sequence count continuity depends on the previous packets, it is checked in order.
+  bool result{true};
+  for (size_t index = 0; index < count; ++index) {
+    auto &report = m_reports[index];
+    checkSequenceCount(packets[index].getSequenceFlags(), packets[index].getSequenceCount(), report);
+    result &= std::all_of(report.begin(), report.end(), [](const bool check) { return check; });
+  }
+  m_report = count > 0 ? m_reports.back() : std::vector<bool>{};
+  return result;
+}
+
+bool CCSDS::Validator::validateHeader(Header toValidateHeader, const size_t dataFieldBytesSize, const bool crcMatches) {
+  checkPacket(toValidateHeader, dataFieldBytesSize, crcMatches, getTemplateHeader(), m_report);
+  checkSequenceCount(toValidateHeader.getSequenceFlags(), toValidateHeader.getSequenceCount(), m_report);
+  return std::all_of(m_report.begin(), m_report.end(), [](const bool check) { return check; });
+}
+
+void CCSDS::Validator::checkPacket(Header toValidateHeader, const size_t dataFieldBytesSize, const bool crcMatches,
+                                   Header templateHeader, std::vector<bool> &report) const {
+  report.reserve(m_reportSize);
+  report.assign({true, true, true, true, true, true});
 
   // test CRC therefore full data field coherence
   if (m_validatePacketCoherence) {
-    m_report[0] = toValidateHeader.getDataLength() == dataFieldBytesSize;
-    result &= m_report[0];
-    const auto calcCRC = crc16(dataFieldBytes);
-    m_report[1] = calcCRC == toValidate.getCRC();
-    result &= m_report[1];
+    report[0] = toValidateHeader.getDataLength() == dataFieldBytesSize;
+    report[1] = crcMatches;
     if (toValidateHeader.getSequenceFlags() == UNSEGMENTED) {
-      m_report[2] = toValidateHeader.getSequenceCount() == 0;
+      report[2] = toValidateHeader.getSequenceCount() == 0;
     } else {
-      m_report[2] = toValidateHeader.getSequenceCount() > 0;
-      if (m_validateSegmentedCount) {
-        if (toValidateHeader.getSequenceFlags() == FIRST_SEGMENT) {
-          m_report[3] = toValidateHeader.getSequenceCount() == 1;
-        }else {
-          m_report[3] = toValidateHeader.getSequenceCount() == m_sequenceCounter;
-        }
-        m_sequenceCounter++;
-      }
+      // segment counts start at 1, only a continuation past 16383 wraps to 0.
+      report[2] = toValidateHeader.getSequenceFlags() != FIRST_SEGMENT || toValidateHeader.getSequenceCount() > 0;
     }
-    result &= m_report[2];
-    result &= m_report[3];
   }
 
   if (m_validateAgainstTemplate) {
-    m_templatePacket.setUpdatePacketEnable(false);
-    auto templateHeader = m_templatePacket.getPrimaryHeader();
-    const auto templateHeaderData = templateHeader.serialize();
-    m_report[4] = templateHeaderData[0] == toValidateHeaderData[0] && templateHeaderData[1] == toValidateHeaderData[1];
-    result &= m_report[4];
+    const auto toValidateHeaderData = encodePrimaryHeader(toValidateHeader.getData());
+    const auto templateHeaderData = encodePrimaryHeader(templateHeader.getData());
+    report[4] = templateHeaderData[0] == toValidateHeaderData[0] && templateHeaderData[1] == toValidateHeaderData[1];
     if (templateHeader.getSequenceFlags() == UNSEGMENTED) {
-      m_report[5] = toValidateHeader.getSequenceFlags() == UNSEGMENTED;
+      report[5] = toValidateHeader.getSequenceFlags() == UNSEGMENTED;
     } else {
-      m_report[5] = toValidateHeader.getSequenceFlags() != UNSEGMENTED;
+      report[5] = toValidateHeader.getSequenceFlags() != UNSEGMENTED;
     }
-    result &= m_report[5];
   }
-  return result;
+}
+
+void CCSDS::Validator::checkSequenceCount(const std::uint8_t sequenceFlags, const std::uint16_t sequenceCount,
+                                          std::vector<bool> &report) {
+  if (!m_validatePacketCoherence || !m_validateSegmentedCount || sequenceFlags == UNSEGMENTED) {
+    return;
+  }
+  if (sequenceFlags == FIRST_SEGMENT) {
+    report[3] = sequenceCount == 1;
+  } else {
+    report[3] = sequenceCount == m_sequenceCounter;
+  }
+  m_sequenceCounter = (m_sequenceCounter + 1) & 0x3FFF; // the 14 bits sequence count wraps to 0.
+}
+
+CCSDS::Header CCSDS::Validator::getTemplateHeader() {
+  if (!m_validateAgainstTemplate) {
+    return {};
+  }
+  m_templatePacket.setUpdatePacketEnable(false);
+  return m_templatePacket.getPrimaryHeader();
 }
 
 void CCSDS::Validator::clear() {
@@ -7,14 +7,19 @@
 #include "CCSDSUtils.h"
 
 CCSDS::ResultBool PusA::deserialize(const std::vector<std::uint8_t> &data) {
-  RET_IF_ERR_MSG(data.size() != m_size, CCSDS::ErrorCode::INVALID_SECONDARY_HEADER_DATA,
+  FORWARD_RESULT(deserialize(data.data(), data.size()));
+  return true;
+}
+
+CCSDS::ResultBool PusA::deserialize(const std::uint8_t *pData, const std::size_t sizeData) {
+  RET_IF_ERR_MSG(sizeData != kSize, CCSDS::ErrorCode::INVALID_SECONDARY_HEADER_DATA,
                  "PUS-A header not correct size (size != 6 bytes)");
 
-  m_version = data[0] & 0x7;
-  m_serviceType = data[1];
-  m_serviceSubType = data[2];
-  m_sourceID = data[3];
-  m_dataLength = data[4] << 8 | data[5];
+  m_version = pData[0] & 0x7;
+  m_serviceType = pData[1];
+  m_serviceSubType = pData[2];
+  m_sourceID = pData[3];
+  m_dataLength = pData[4] << 8 | pData[5];
   return true;
 }
 
@@ -31,19 +36,34 @@ std::vector<std::uint8_t> PusA::serialize() const {
   return data;
 }
 
+std::uint16_t PusA::serializeInto(std::uint8_t *pData) const {
+  pData[0] = static_cast<std::uint8_t>(m_version & 0x7);
+  pData[1] = m_serviceType;
+  pData[2] = m_serviceSubType;
+  pData[3] = m_sourceID;
+  pData[4] = static_cast<std::uint8_t>(m_dataLength >> 8 & 0xFF);
+  pData[5] = static_cast<std::uint8_t>(m_dataLength & 0xFF);
+  return kSize;
+}
+
 void PusA::update(CCSDS::DataField* dataField) {
   m_dataLength = dataField->getApplicationDataBytesSize();
 }
 
 CCSDS::ResultBool PusB::deserialize(const std::vector<std::uint8_t> &data) {
-  RET_IF_ERR_MSG(data.size() != m_size, CCSDS::ErrorCode::INVALID_SECONDARY_HEADER_DATA,
+  FORWARD_RESULT(deserialize(data.data(), data.size()));
+  return true;
+}
+
+CCSDS::ResultBool PusB::deserialize(const std::uint8_t *pData, const std::size_t sizeData) {
+  RET_IF_ERR_MSG(sizeData != kSize, CCSDS::ErrorCode::INVALID_SECONDARY_HEADER_DATA,
                  "PUS-B header not correct size (size != 8 bytes)");
-  m_version = data[0] & 0x7;
-  m_serviceType = data[1];
-  m_serviceSubType = data[2];
-  m_sourceID = data[3];
-  m_eventID = data[4] << 8 | data[5];
-  m_dataLength = data[6] << 8 | data[7];
+  m_version = pData[0] & 0x7;
+  m_serviceType = pData[1];
+  m_serviceSubType = pData[2];
+  m_sourceID = pData[3];
+  m_eventID = pData[4] << 8 | pData[5];
+  m_dataLength = pData[6] << 8 | pData[7];
   return true;
 }
 
@@ -62,22 +82,37 @@ std::vector<std::uint8_t> PusB::serialize() const {
   return data;
 }
 
+std::uint16_t PusB::serializeInto(std::uint8_t *pData) const {
+  pData[0] = static_cast<std::uint8_t>(m_version & 0x7);
+  pData[1] = m_serviceType;
+  pData[2] = m_serviceSubType;
+  pData[3] = m_sourceID;
+  pData[4] = static_cast<std::uint8_t>(m_eventID >> 8 & 0xFF);
+  pData[5] = static_cast<std::uint8_t>(m_eventID & 0xFF);
+  pData[6] = static_cast<std::uint8_t>(m_dataLength >> 8 & 0xFF);
+  pData[7] = static_cast<std::uint8_t>(m_dataLength & 0xFF);
+  return kSize;
+}
+
 void PusB::update(CCSDS::DataField* dataField) {
   m_dataLength = dataField->getApplicationDataBytesSize();
 }
 
 
 CCSDS::ResultBool PusC::deserialize(const std::vector<std::uint8_t> &data) {
-  RET_IF_ERR_MSG(data.size() <= m_size, CCSDS::ErrorCode::INVALID_SECONDARY_HEADER_DATA,
+  FORWARD_RESULT(deserialize(data.data(), data.size()));
+  return true;
+}
+
+CCSDS::ResultBool PusC::deserialize(const std::uint8_t *pData, const std::size_t sizeData) {
+  RET_IF_ERR_MSG(sizeData <= kSize, CCSDS::ErrorCode::INVALID_SECONDARY_HEADER_DATA,
                  "PUS-C header not correct size (size <= 6 bytes)");
-  m_version = data[0] & 0x7;
-  m_serviceType = data[1];
-  m_serviceSubType = data[2];
-  m_sourceID = data[3];
-  m_dataLength = data[data.size()-2] << 8 | data[data.size()-1];
-  if (data.size() > 6) {
-    m_timeCode.assign(data.begin() + 4, data.end()-2);
-  }
+  m_version = pData[0] & 0x7;
+  m_serviceType = pData[1];
+  m_serviceSubType = pData[2];
+  m_sourceID = pData[3];
+  m_dataLength = pData[sizeData-2] << 8 | pData[sizeData-1];
+  m_timeCode.assign(pData + 4, pData + sizeData - 2);
   return true;
 }
 
@@ -100,6 +135,18 @@ std::vector<std::uint8_t> PusC::serialize() const {
   return data;
 }
 
+std::uint16_t PusC::serializeInto(std::uint8_t *pData) const {
+  pData[0] = static_cast<std::uint8_t>(m_version & 0x7);
+  pData[1] = m_serviceType;
+  pData[2] = m_serviceSubType;
+  pData[3] = m_sourceID;
+  std::copy(m_timeCode.begin(), m_timeCode.end(), pData + 4);
+  const std::size_t offset = 4 + m_timeCode.size();
+  pData[offset] = static_cast<std::uint8_t>(m_dataLength >> 8 & 0xFF);
+  pData[offset + 1] = static_cast<std::uint8_t>(m_dataLength & 0xFF);
+  return getSize();
+}
+
 void PusC::update(CCSDS::DataField* dataField) {
   m_dataLength = dataField->getApplicationDataBytesSize();
 }
@@ -117,10 +164,10 @@ CCSDS::ResultBool PusA::loadFromConfig(const Config& cfg) {
   RET_IF_ERR_MSG(!cfg.isKey("pus_service_sub_type"), CCSDS::ErrorCode::CONFIG_FILE_ERROR,"Config: Missing string field: pus_service_sub_type");
   RET_IF_ERR_MSG(!cfg.isKey("pus_source_id"), CCSDS::ErrorCode::CONFIG_FILE_ERROR,"Config: Missing string field: pus_source_id");
 
-  ASSIGN_OR_PRINT(version, cfg.get<int>("pus_version"));
-  ASSIGN_OR_PRINT(serviceType, cfg.get<int>("pus_service_type"));
-  ASSIGN_OR_PRINT(serviceSubType,cfg.get< int>("pus_service_sub_type"));
-  ASSIGN_OR_PRINT(sourceId,cfg.get<int>("pus_source_id"));
+  ASSIGN_CONFIG_OR_PRINT(version, cfg, int, "pus_version");
+  ASSIGN_CONFIG_OR_PRINT(serviceType, cfg, int, "pus_service_type");
+  ASSIGN_CONFIG_OR_PRINT(serviceSubType, cfg, int, "pus_service_sub_type");
+  ASSIGN_CONFIG_OR_PRINT(sourceId, cfg, int, "pus_source_id");
 
   m_version = version & 0x7;
   m_serviceType = serviceType & 0xFF;
@@ -143,11 +190,11 @@ CCSDS::ResultBool PusB::loadFromConfig(const Config &cfg) {
   RET_IF_ERR_MSG(!cfg.isKey("pus_source_id"), CCSDS::ErrorCode::CONFIG_FILE_ERROR,"Config: Missing string field: pus_source_id");
   RET_IF_ERR_MSG(!cfg.isKey("pus_event_id"), CCSDS::ErrorCode::CONFIG_FILE_ERROR,"Config: Missing string field: pus_event_id");
 
-  ASSIGN_OR_PRINT(version, cfg.get<int>("pus_version"));
-  ASSIGN_OR_PRINT(serviceType, cfg.get<int>("pus_service_type"));
-  ASSIGN_OR_PRINT(serviceSubType,cfg.get< int>("pus_service_sub_type"));
-  ASSIGN_OR_PRINT(sourceId,cfg.get<int>("pus_source_id"));
-  ASSIGN_OR_PRINT(eventId,cfg.get<int>("pus_event_id"));
+  ASSIGN_CONFIG_OR_PRINT(version, cfg, int, "pus_version");
+  ASSIGN_CONFIG_OR_PRINT(serviceType, cfg, int, "pus_service_type");
+  ASSIGN_CONFIG_OR_PRINT(serviceSubType, cfg, int, "pus_service_sub_type");
+  ASSIGN_CONFIG_OR_PRINT(sourceId, cfg, int, "pus_source_id");
+  ASSIGN_CONFIG_OR_PRINT(eventId, cfg, int, "pus_event_id");
 
   m_version = version & 0x7;
   m_serviceType = serviceType & 0xFF;
@@ -171,11 +218,11 @@ CCSDS::ResultBool PusC::loadFromConfig(const Config& cfg) {
   RET_IF_ERR_MSG(!cfg.isKey("pus_source_id"), CCSDS::ErrorCode::CONFIG_FILE_ERROR,"Config: Missing string field: pus_source_id");
   RET_IF_ERR_MSG(!cfg.isKey("pus_time_code"), CCSDS::ErrorCode::CONFIG_FILE_ERROR,"Config: Missing string field: pus_time_code");
 
-  ASSIGN_OR_PRINT(version, cfg.get<int>("pus_version"));
-  ASSIGN_OR_PRINT(serviceType, cfg.get<int>("pus_service_type"));
-  ASSIGN_OR_PRINT(serviceSubType,cfg.get< int>("pus_service_sub_type"));
-  ASSIGN_OR_PRINT(sourceId,cfg.get<int>("pus_source_id"));
-  ASSIGN_OR_PRINT(timeCode,cfg.get<std::vector<std::uint8_t>>("pus_time_code"));
+  ASSIGN_CONFIG_OR_PRINT(version, cfg, int, "pus_version");
+  ASSIGN_CONFIG_OR_PRINT(serviceType, cfg, int, "pus_service_type");
+  ASSIGN_CONFIG_OR_PRINT(serviceSubType, cfg, int, "pus_service_sub_type");
+  ASSIGN_CONFIG_OR_PRINT(sourceId, cfg, int, "pus_source_id");
+  ASSIGN_CONFIG_OR_PRINT(timeCode, cfg, std::vector<std::uint8_t>, "pus_time_code");
 
   m_version = version & 0x7;
   m_serviceType = serviceType & 0xFF;
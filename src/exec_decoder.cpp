@@ -6,12 +6,14 @@
  * This is the source file that holds the execution logic of ccsds_encoder binary file.
  */
 
+#include <map>
 #include <unordered_map>
 #include <string>
 #include <vector>
 #include <iostream>
 #include <chrono>
 #include <sstream>
+#include <cstdio>
 #include "CCSDSPack.h"
 #include "exec_utils.h"
 
@@ -45,6 +47,10 @@ void printHelpDecoder() {
   std::cout << "Optionals:" << std::endl;
   std::cout << " -h or --help              : Show this help and message" << std::endl;
   std::cout << " -v or --verbose           : Show generated packets information" << std::endl;
+  std::cout << " -d or --demux             : Route packets by APID, one output per APID named" << std::endl;
+  std::cout << "                             <output>_apid<APID><ext>, in a single pass" << std::endl;
+  std::cout << " -s or --stream            : Decode the input in chunks and write the output as it is" << std::endl;
+  std::cout << "                             decoded, memory use does not depend on the input size" << std::endl;
   std::cout << std::endl;
   std::cout << "Note : the template CCSDS packet is defined in the configuration file" << std::endl;
   std::cout << "       This should follow the guide lines provided in the link below." << std::endl;
@@ -52,6 +58,150 @@ void printHelpDecoder() {
   std::cout << "For further information please visit: https://github.com/ExoSpaceLabs/CCSDSPack" << std::endl;
 }
 
+/**
+ * Returns the output file of an APID in demux mode, the APID is inserted before the extension.
+ */
+std::string demuxOutputName(const std::string &output, const std::uint16_t apid) {
+  const auto separator = output.find_last_of("/\\");
+  auto extension = output.find_last_of('.');
+  if (extension == std::string::npos || (separator != std::string::npos && extension < separator)) {
+    extension = output.size();
+  }
+  return output.substr(0, extension) + "_apid" + std::to_string(apid) + output.substr(extension);
+}
+
+/**
+ * Input chunk size and output buffer size of the stream mode.
+ */
+constexpr std::size_t kStreamChunkSize = 1 << 20;
+constexpr std::size_t kStreamWriterSize = 1 << 20;
+constexpr std::size_t kStreamDemuxWriterSize = 64 << 10;
+
+/**
+ * Decodes the input chunk by chunk, every packet is validated and its application data written as soon
+ * as it is located. Memory use is bounded by the input chunk, the decoder carry over and the output buffer.
+ */
+CCSDS::ResultBool streamDecode(const std::string &appName, CCSDS::Manager &manager, const std::string &input,
+                               const std::string &output, const bool validationEnable) {
+  CCSDS::StreamDecoder decoder;
+  decoder.setSyncPatternEnable(manager.getSyncPatternEnable());
+  decoder.setSyncPattern(manager.getSyncPattern());
+  decoder.setResyncEnable(manager.getResyncEnable());
+  // the validator of the manager checks the packets against the loaded template, as in the normal mode.
+  CCSDS::Validator &validator = manager.getValidatorReference();
+
+  BufferedFileWriter writer(kStreamWriterSize);
+  FORWARD_RESULT(writer.open(output));
+
+  std::uint64_t index{0};
+  FORWARD_RESULT(readFileChunks(input, kStreamChunkSize,
+    [&](const std::uint8_t *pData, const std::size_t sizeData) -> CCSDS::ResultBool {
+      // the decoder is drained before the chunk is overwritten, a partial packet is kept in its carry over.
+      decoder.push(pData, sizeData);
+      CCSDS::PacketView view;
+      bool packetFound{false};
+      ASSIGN_CP(packetFound, decoder.next(view));
+      while (packetFound) {
+        if (validationEnable && !validator.validate(view)) {
+          return CCSDS::Error{CCSDS::ErrorCode::VALIDATION_FAILURE, "Validation failure for packet"}
+              .withIndex(index).withApid(view.getAPID());
+        }
+        const auto applicationData = view.getApplicationData();
+        FORWARD_RESULT(writer.write(applicationData.data, applicationData.size));
+        index++;
+        ASSIGN_CP(packetFound, decoder.next(view));
+      }
+      return true;
+    }));
+
+  if (decoder.getResyncEnable() && decoder.getSyncPatternEnable()) {
+    decoder.skipBuffered();
+  }
+  RET_IF_ERR_MSG(decoder.getBufferedBytes() != 0, CCSDS::ErrorCode::INVALID_DATA,
+                 "Packet truncated, stream ends before the declared data length.");
+  RET_IF_ERR_MSG(index == 0, CCSDS::ErrorCode::NO_DATA, "Cannot get Application data, no packets have been set.");
+  FORWARD_RESULT(writer.close());
+
+  if (decoder.getSkippedRegions() != 0) {
+    customConsole(appName, "resynchronised on sync pattern, skipped " + std::to_string(decoder.getSkippedRegions()) +
+                  " corrupt region(s), " + std::to_string(decoder.getSkippedBytes()) + " bytes");
+  }
+  customConsole(appName, "decoded " + std::to_string(index) + " packets, " +
+                std::to_string(writer.getBytesWritten()) + " bytes written to " + output);
+  return true;
+}
+
+/**
+ * Demultiplexes the input chunk by chunk, the outputs of the APIDs are opened on their first unit and removed
+ * again if the input cannot be demultiplexed to the end.
+ */
+CCSDS::ResultBool streamDemux(const std::string &appName, CCSDS::Manager &manager, const std::string &input,
+                              const std::string &output, const bool validationEnable) {
+  std::map<std::uint16_t, BufferedFileWriter> writers;
+  std::vector<std::string> apidOutputs;
+  CCSDS::ResultBool sinkResult{true};
+  auto sink = [&](const std::uint16_t apid, const std::uint8_t *pData, const std::size_t sizeData) {
+    if (!sinkResult.has_value()) {
+      return;
+    }
+    auto it = writers.find(apid);
+    if (it == writers.end()) {
+      const std::string apidOutput = demuxOutputName(output, apid);
+      customConsole(appName,"writing data to " + apidOutput);
+      apidOutputs.push_back(apidOutput);
+      it = writers.emplace(apid, BufferedFileWriter(kStreamDemuxWriterSize)).first;
+      sinkResult = it->second.open(apidOutput);
+    }
+    if (sinkResult.has_value()) {
+      sinkResult = it->second.write(pData, sizeData);
+    }
+  };
+  // do not leave partial outputs behind, the files are closed before they are removed.
+  const auto failed = [&](const CCSDS::Error &error) -> CCSDS::ResultBool {
+    writers.clear();
+    for (const auto &apidOutput : apidOutputs) {
+      std::remove(apidOutput.c_str());
+    }
+    return error;
+  };
+  CCSDS::Demultiplexer demultiplexer;
+  demultiplexer.setSyncPatternEnable(manager.getSyncPatternEnable());
+  demultiplexer.setSyncPattern(manager.getSyncPattern());
+  demultiplexer.setResyncEnable(manager.getResyncEnable());
+  demultiplexer.setValidateEnable(validationEnable);
+  demultiplexer.setDefaultSink(sink);
+  FORWARD_RESULT(demultiplexer.addChannel(manager.getTemplate(), sink));
+
+  if (const auto res = readFileChunks(input, kStreamChunkSize,
+    [&](const std::uint8_t *pData, const std::size_t sizeData) -> CCSDS::ResultBool {
+      FORWARD_RESULT(demultiplexer.push(pData, sizeData));
+      return sinkResult;
+    }); !res.has_value()) {
+    return failed(res.error());
+  }
+  if (const auto res = demultiplexer.finish(); !res.has_value()) {
+    return failed(res.error());
+  }
+  for (auto &[apid, writer] : writers) {
+    if (const auto res = writer.close(); !res.has_value()) {
+      return failed(res.error());
+    }
+  }
+
+  if (demultiplexer.getSkippedRegions() != 0) {
+    customConsole(appName, "resynchronised on sync pattern, skipped " + std::to_string(demultiplexer.getSkippedRegions()) +
+                  " corrupt region(s), " + std::to_string(demultiplexer.getSkippedBytes()) + " bytes");
+  }
+  for (const auto apid : demultiplexer.getChannels()) {
+    CCSDS::DemuxChannelStatistics statistics;
+    ASSIGN_CP(statistics, demultiplexer.getChannelStatistics(apid));
+    customConsole(appName, "APID " + std::to_string(apid) + ": " + std::to_string(statistics.packets) + " packets, " +
+                  std::to_string(statistics.invalidPackets) + " invalid, " +
+                  std::to_string(statistics.reassembly.droppedSegments) + " dropped segments");
+  }
+  return true;
+}
+
 int main(const int argc, char* argv[]) {
   std::string appName = "ccsds_decoder";
 
@@ -61,16 +211,20 @@ int main(const int argc, char* argv[]) {
   allowed.insert({"i", "input"});
   allowed.insert({"o", "output"});
   allowed.insert({"c", "config"});
+  allowed.insert({"d", "demux"});
+  allowed.insert({"s", "stream"});
 
-  const std::set<std::string> booleanArgs{"verbose", "help"};
+  const std::set<std::string> booleanArgs{"verbose", "help", "demux", "stream"};
 
   std::unordered_map<std::string, std::string> args;
   args.insert({"verbose", "false"});
   args.insert({"help", "false"});
+  args.insert({"demux", "false"});
+  args.insert({"stream", "false"});
 
   const auto start = std::chrono::high_resolution_clock::now();
   if (const auto res = parseArguments(argc, argv, allowed, args, booleanArgs); !res.has_value()) {
-    std::cerr << "[ Error " << res.error().code() << " ]: "<<  res.error().message() << std::endl ;
+    std::cerr << "[ Error " << res.error().code() << " ]: "<<  res.error().text() << ": " << argv[res.error().index()] << std::endl ;
     return res.error().code();
   }
    // std::cout << "Parsed args:\n";
@@ -82,6 +236,8 @@ int main(const int argc, char* argv[]) {
     return 0;
   }
   bool verbose{args["verbose"] == "true"};
+  const bool demux{args["demux"] == "true"};
+  const bool stream{args["stream"] == "true"};
 
   if (args.find("input") == args.end()) {
     std::cerr << "[ Error " << ARG_PARSE_ERROR << " ]: " << "Input file must be specified" << std::endl;
@@ -128,20 +284,25 @@ int main(const int argc, char* argv[]) {
 
   if (cfg.isKey("data_field_size")) {
     std::uint16_t dataFieldSize;
-    ASSIGN_OR_PRINT(dataFieldSize, cfg.get<int>("data_field_size"));
+    ASSIGN_CONFIG_OR_PRINT(dataFieldSize, cfg, int, "data_field_size");
     manager.setDataFieldSize(dataFieldSize);
 
   }
 
   if (cfg.isKey("sync_pattern_enable")) {
     bool syncPatternEnable;
-    ASSIGN_OR_PRINT(syncPatternEnable, cfg.get<bool>("sync_pattern_enable"));
+    ASSIGN_CONFIG_OR_PRINT(syncPatternEnable, cfg, bool, "sync_pattern_enable");
     manager.setSyncPatternEnable(syncPatternEnable);
     if (syncPatternEnable && cfg.isKey("sync_pattern")) {
       std::uint32_t syncPattern;
-      ASSIGN_OR_PRINT(syncPattern, cfg.get<int>("sync_pattern"));
+      ASSIGN_CONFIG_OR_PRINT(syncPattern, cfg, int, "sync_pattern");
       manager.setSyncPattern(syncPattern);
     }
+    if (syncPatternEnable && cfg.isKey("sync_pattern_resync")) {
+      bool resyncEnable{false};
+      ASSIGN_CONFIG_OR_PRINT(resyncEnable, cfg, bool, "sync_pattern_resync");
+      manager.setResyncEnable(resyncEnable);
+    }
   }
 
   bool validationEnable;
@@ -149,7 +310,7 @@ int main(const int argc, char* argv[]) {
     std::cerr << "[ Error " << CONFIG_MISSING_PARAMETER << " ]: " << "Config: Missing bool field: validation_enable" << std::endl;
     return CONFIG_MISSING_PARAMETER;
   }
-  ASSIGN_OR_PRINT(validationEnable, cfg.get<bool>("validation_enable"));
+  ASSIGN_CONFIG_OR_PRINT(validationEnable, cfg, bool, "validation_enable");
   customConsole(appName,"creating CCSDS template packet");
 
   if (const auto res = manager.loadTemplateConfig(cfg);!res.has_value()) {
@@ -157,25 +318,94 @@ int main(const int argc, char* argv[]) {
     return res.error().code();
   }
 
-  std::vector<std::uint8_t> inputBytes;
+  if (stream) {
+    customConsole(appName, demux ? "demultiplexing CCSDS packets by APID from file in stream mode"
+                                 : "decoding CCSDS packets from file in stream mode");
+    if (verbose) customConsole(appName, "packets are not kept in stream mode, verbose listing is skipped", "WARNING");
+    const auto res = demux ? streamDemux(appName, manager, input, output, validationEnable)
+                           : streamDecode(appName, manager, input, output, validationEnable);
+    if (!res.has_value()) {
+      if (!demux) std::remove(output.c_str()); // do not leave a partial output behind, demux removes its own.
+      std::cerr << "[ Error " << res.error().code() << " ]: "<<  res.error().message() << std::endl ;
+      return res.error().code();
+    }
+    const auto end = std::chrono::high_resolution_clock::now();
+    const auto duration = std::chrono::duration_cast<std::chrono::microseconds>(end - start);
+    customConsole(appName,"execution time: " + std::to_string(duration.count()) + " [us]");
+    customConsole(appName,"[ Exit code 0 ]");
+    return 0;
+  }
+
+  CCSDS::MappedFile inputFile;
   customConsole(appName,"reading data from " + input);
 
-  if (const auto res = readBinaryFile(input); !res.has_value()) {
+  if (const auto res = inputFile.open(input); !res.has_value()) {
     std::cerr << "[ Error " << res.error().code() << " ]: "<<  res.error().message() << std::endl ;
     return res.error().code();
   }else {
-    inputBytes = res.value();
-    if (manager.getTemplate().getPrimaryHeader().getSequenceFlags() == CCSDS::UNSEGMENTED && inputBytes.size() > manager.getDataFieldSize()){
+    if (!demux && manager.getTemplate().getPrimaryHeader().getSequenceFlags() == CCSDS::UNSEGMENTED && inputFile.size() > manager.getDataFieldSize()){
       std::cerr << "[ Error " << INVALID_INPUT_DATA << " ]: "<<  "Input data is too big for unsegmented packets, data "
-      << inputBytes.size() << " must be less than defined data packet length of " << manager.getDataFieldSize() << std::endl ;
+      << inputFile.size() << " must be less than defined data packet length of " << manager.getDataFieldSize() << std::endl ;
       return INVALID_INPUT_DATA;
     }
   }
+  if (demux) {
+    // every APID gets its own channel, the template APID is validated against the template.
+    customConsole(appName, "demultiplexing CCSDS packets by APID from file");
+    std::map<std::uint16_t, std::vector<std::uint8_t>> outputs;
+    auto sink = [&outputs](const std::uint16_t apid, const std::uint8_t *pData, const std::size_t sizeData) {
+      auto &outputData = outputs[apid];
+      outputData.insert(outputData.end(), pData, pData + sizeData);
+    };
+    CCSDS::Demultiplexer demultiplexer;
+    demultiplexer.setSyncPatternEnable(manager.getSyncPatternEnable());
+    demultiplexer.setSyncPattern(manager.getSyncPattern());
+    demultiplexer.setResyncEnable(manager.getResyncEnable());
+    demultiplexer.setValidateEnable(validationEnable);
+    demultiplexer.setDefaultSink(sink);
+    if (const auto res = demultiplexer.addChannel(manager.getTemplate(), sink); !res.has_value()) {
+      std::cerr << "[ Error " << res.error().code() << " ]: "<<  res.error().message() << std::endl ;
+      return res.error().code();
+    }
+    if (const auto res = demultiplexer.decode(inputFile.data(), inputFile.size()); !res.has_value()) {
+      std::cerr << "[ Error " << res.error().code() << " ]: "<<  res.error().message() << std::endl ;
+      return res.error().code();
+    }
+    if (demultiplexer.getSkippedRegions() != 0) {
+      customConsole(appName, "resynchronised on sync pattern, skipped " + std::to_string(demultiplexer.getSkippedRegions()) +
+                    " corrupt region(s), " + std::to_string(demultiplexer.getSkippedBytes()) + " bytes");
+    }
+    for (const auto apid : demultiplexer.getChannels()) {
+      CCSDS::DemuxChannelStatistics statistics;
+      ASSIGN_OR_PRINT(statistics, demultiplexer.getChannelStatistics(apid));
+      customConsole(appName, "APID " + std::to_string(apid) + ": " + std::to_string(statistics.packets) + " packets, " +
+                    std::to_string(statistics.invalidPackets) + " invalid, " +
+                    std::to_string(statistics.reassembly.droppedSegments) + " dropped segments");
+      if (const auto it = outputs.find(apid); it != outputs.end()) {
+        const std::string apidOutput = demuxOutputName(output, apid);
+        customConsole(appName,"writing data to " + apidOutput);
+        if (const auto res = writeBinaryFile(it->second, apidOutput); !res.has_value()) {
+          std::cerr << "[ Error " << res.error().code() << " ]: "<<  res.error().message() << std::endl ;
+          return res.error().code();
+        }
+      }
+    }
+    const auto end = std::chrono::high_resolution_clock::now();
+    const auto duration = std::chrono::duration_cast<std::chrono::microseconds>(end - start);
+    customConsole(appName,"execution time: " + std::to_string(duration.count()) + " [us]");
+    customConsole(appName,"[ Exit code 0 ]");
+    return 0;
+  }
+
   customConsole(appName, "deserializing CCSDS packets from file");
-  if (const auto res = manager.load(inputBytes); !res.has_value()) {
+  if (const auto res = manager.load(inputFile.data(), inputFile.size()); !res.has_value()) {
     std::cerr << "[ Error " << res.error().code() << " ]: "<<  res.error().message() << std::endl ;
     return res.error().code();
   }
+  if (manager.getSkippedRegions() != 0) {
+    customConsole(appName, "resynchronised on sync pattern, skipped " + std::to_string(manager.getSkippedRegions()) +
+                  " corrupt region(s), " + std::to_string(manager.getSkippedBytes()) + " bytes");
+  }
   if (verbose) customConsole(appName,"printing loaded packets data to screen:");
   if (verbose) printPackets(manager);
 
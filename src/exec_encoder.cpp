@@ -12,6 +12,13 @@
 #include <iostream>
 #include <chrono>
 #include <sstream>
+#include <algorithm>
+#include <condition_variable>
+#include <cstdio>
+#include <fstream>
+#include <mutex>
+#include <optional>
+#include <thread>
 #include "CCSDSPack.h"
 #include "exec_utils.h"
 
@@ -44,6 +51,8 @@ void printHelp() {
   std::cout << "Optionals:" << std::endl;
   std::cout << " -h or --help              : Show this help and message" << std::endl;
   std::cout << " -v or --verbose           : Show generated packets information" << std::endl;
+  std::cout << " -s or --stream            : Encode the input in chunks, reading, packetizing and writing" << std::endl;
+  std::cout << "                             concurrently, memory use does not depend on the input size" << std::endl;
   std::cout << std::endl;
   std::cout << "Note : the template CCSDS packet is defined in the configuration file" << std::endl;
   std::cout << "       This should follow the guide lines provided in the link below." << std::endl;
@@ -51,6 +60,144 @@ void printHelp() {
   std::cout << "For further information please visit: https://github.com/ExoSpaceLabs/CCSDSPack" << std::endl;
 }
 
+/**
+ * Input chunk size and output buffer size of the stream mode.
+ */
+constexpr std::size_t kStreamChunkSize = 1 << 20;
+constexpr std::size_t kStreamWriterSize = 4 << 20;
+
+/**
+ * Encodes the input as a pipeline, the calling thread reads chunks aligned on packet boundaries, worker
+ * threads packetize them and a writer thread appends the encoded chunks in order. Chunks travel through a
+ * ring of slots, workers + 2, so memory use is bounded by the ring whatever the input size.
+ */
+CCSDS::ResultBool streamEncode(const std::string &appName, CCSDS::Manager &manager, const std::string &input,
+                               const std::uint64_t inputSize, const std::string &output) {
+  CCSDS::StreamEncoder encoder;
+  FORWARD_RESULT(encoder.setTemplate(manager.getTemplate()));
+  encoder.setSyncPatternEnable(manager.getSyncPatternEnable());
+  encoder.setSyncPattern(manager.getSyncPattern());
+  FORWARD_RESULT(encoder.begin(inputSize));
+
+  std::ifstream in(input, std::ios::binary);
+  RET_IF_ERR_MSG(!in, CCSDS::ErrorCode::FILE_READ_ERROR, "Failed to open file for reading");
+  BufferedFileWriter writer(kStreamWriterSize);
+  FORWARD_RESULT(writer.open(output));
+
+  const std::size_t packetsPerChunk = (kStreamChunkSize + encoder.getMaxBytesPerPacket() - 1) / encoder.getMaxBytesPerPacket();
+  const std::size_t chunkSize = packetsPerChunk * encoder.getMaxBytesPerPacket();
+  const std::uint64_t chunkCount = (inputSize + chunkSize - 1) / chunkSize;
+  // a secondary header that cannot be cloned is shared with the template, its packets are built on one thread.
+  std::uint32_t workerCount = encoder.isConcurrent() ? std::max(1u, std::thread::hardware_concurrency()) : 1;
+  workerCount = static_cast<std::uint32_t>(std::min<std::uint64_t>(workerCount, chunkCount));
+
+  enum class SlotState { FREE, READ, ENCODING, ENCODED };
+  struct Slot {
+    std::vector<std::uint8_t> input;
+    std::vector<std::uint8_t> output;
+    std::uint64_t chunk{0};
+    SlotState state{SlotState::FREE};
+  };
+  std::vector<Slot> slots(workerCount + 2);
+  std::mutex mutex;
+  std::condition_variable changed;
+  std::optional<CCSDS::Error> error;
+  std::uint64_t nextEncode{0};
+
+  auto fail = [&](const CCSDS::Error &failure) {
+    const std::lock_guard lock(mutex);
+    if (!error.has_value()) {
+      error = failure;
+    }
+    changed.notify_all();
+  };
+
+  auto encodeChunks = [&] {
+    std::unique_lock lock(mutex);
+    while (true) {
+      changed.wait(lock, [&] {
+        const Slot &slot = slots[nextEncode % slots.size()];
+        return error.has_value() || nextEncode == chunkCount ||
+               (slot.state == SlotState::READ && slot.chunk == nextEncode);
+      });
+      if (error.has_value() || nextEncode == chunkCount) {
+        return;
+      }
+      Slot &slot = slots[nextEncode++ % slots.size()];
+      slot.state = SlotState::ENCODING;
+      lock.unlock();
+      slot.output.clear();
+      const auto res = encoder.encode(slot.chunk * chunkSize, slot.input.data(), slot.input.size(), slot.output);
+      if (!res.has_value()) {
+        fail(res.error());
+        return;
+      }
+      lock.lock();
+      slot.state = SlotState::ENCODED;
+      changed.notify_all();
+    }
+  };
+
+  auto writeChunks = [&] {
+    for (std::uint64_t chunk = 0; chunk < chunkCount; chunk++) {
+      Slot &slot = slots[chunk % slots.size()];
+      {
+        std::unique_lock lock(mutex);
+        changed.wait(lock, [&] { return error.has_value() || (slot.state == SlotState::ENCODED && slot.chunk == chunk); });
+        if (error.has_value()) {
+          return;
+        }
+      }
+      if (const auto res = writer.write(slot.output.data(), slot.output.size()); !res.has_value()) {
+        fail(res.error());
+        return;
+      }
+      const std::lock_guard lock(mutex);
+      slot.state = SlotState::FREE;
+      changed.notify_all();
+    }
+  };
+
+  std::vector<std::thread> threads;
+  threads.reserve(workerCount + 1);
+  threads.emplace_back(writeChunks);
+  for (std::uint32_t worker = 0; worker < workerCount; worker++) {
+    threads.emplace_back(encodeChunks);
+  }
+  for (std::uint64_t chunk = 0; chunk < chunkCount; chunk++) {
+    Slot &slot = slots[chunk % slots.size()];
+    {
+      std::unique_lock lock(mutex);
+      changed.wait(lock, [&] { return error.has_value() || slot.state == SlotState::FREE; });
+      if (error.has_value()) {
+        break;
+      }
+    }
+    slot.input.resize(static_cast<std::size_t>(std::min<std::uint64_t>(chunkSize, inputSize - chunk * chunkSize)));
+    in.read(reinterpret_cast<char*>(slot.input.data()), static_cast<std::streamsize>(slot.input.size()));
+    if (static_cast<std::size_t>(in.gcount()) != slot.input.size()) {
+      fail(CCSDS::Error{CCSDS::ErrorCode::FILE_READ_ERROR, "Failed to read the data from the file"});
+      break;
+    }
+    const std::lock_guard lock(mutex);
+    slot.chunk = chunk;
+    slot.state = SlotState::READ;
+    changed.notify_all();
+  }
+  for (auto &thread : threads) {
+    thread.join();
+  }
+  if (error.has_value()) {
+    return error.value();
+  }
+  FORWARD_RESULT(writer.close());
+
+  customConsole(appName, "encoded " + std::to_string(encoder.getPacketCount()) + " packets on " +
+                std::to_string(workerCount) + " thread(s), " + std::to_string(writer.getBytesWritten()) +
+                " bytes written to " + output);
+  return true;
+}
+
 int main(const int argc, char* argv[]) {
   std::string appName = "ccsds_encoder";
 
@@ -60,16 +207,18 @@ int main(const int argc, char* argv[]) {
   allowed.insert({"i", "input"});
   allowed.insert({"o", "output"});
   allowed.insert({"c", "config"});
+  allowed.insert({"s", "stream"});
 
-  const std::set<std::string> booleanArgs{"verbose", "help"};
+  const std::set<std::string> booleanArgs{"verbose", "help", "stream"};
 
   std::unordered_map<std::string, std::string> args;
   args.insert({"verbose", "false"});
   args.insert({"help", "false"});
+  args.insert({"stream", "false"});
 
   const auto start = std::chrono::high_resolution_clock::now();
   if (const auto res = parseArguments(argc, argv, allowed, args, booleanArgs); !res.has_value()) {
-    std::cerr << "[ Error " << res.error().code() << " ]: "<<  res.error().message() << std::endl ;
+    std::cerr << "[ Error " << res.error().code() << " ]: "<<  res.error().text() << ": " << argv[res.error().index()] << std::endl ;
     return res.error().code();
   }
    // std::cout << "Parsed args:\n";
@@ -81,6 +230,7 @@ int main(const int argc, char* argv[]) {
     return 0;
   }
   bool verbose{args["verbose"] == "true"};
+  const bool stream{args["stream"] == "true"};
 
   if (args.find("input") == args.end()) {
     std::cerr << "[ Error " << ARG_PARSE_ERROR << " ]: " << "Input file must be specified" << std::endl;
@@ -127,17 +277,17 @@ int main(const int argc, char* argv[]) {
 
   if (cfg.isKey("data_field_size")) {
     std::uint16_t dataFieldSize;
-    ASSIGN_OR_PRINT(dataFieldSize, cfg.get<int>("data_field_size"));
+    ASSIGN_CONFIG_OR_PRINT(dataFieldSize, cfg, int, "data_field_size");
     manager.setDataFieldSize(dataFieldSize);
   }
 
   if (cfg.isKey("sync_pattern_enable")) {
     bool syncPatternEnable;
-    ASSIGN_OR_PRINT(syncPatternEnable, cfg.get<bool>("sync_pattern_enable"));
+    ASSIGN_CONFIG_OR_PRINT(syncPatternEnable, cfg, bool, "sync_pattern_enable");
     manager.setSyncPatternEnable(syncPatternEnable);
     if (syncPatternEnable && cfg.isKey("sync_pattern")) {
       std::uint32_t syncPattern;
-      ASSIGN_OR_PRINT(syncPattern, cfg.get<int>("sync_pattern"));
+      ASSIGN_CONFIG_OR_PRINT(syncPattern, cfg, int, "sync_pattern");
       manager.setSyncPattern(syncPattern);
     }
   }
@@ -149,6 +299,29 @@ int main(const int argc, char* argv[]) {
     return res.error().code();
   }
 
+  if (stream) {
+    customConsole(appName, "encoding CCSDS packets from " + input + " in stream mode");
+    if (verbose) customConsole(appName, "packets are not kept in stream mode, verbose listing is skipped", "WARNING");
+    std::ifstream inputFile(input, std::ios::binary | std::ios::ate);
+    const auto inputSize = static_cast<std::uint64_t>(inputFile.tellg());
+    inputFile.close();
+    if (manager.getTemplate().getPrimaryHeader().getSequenceFlags() == CCSDS::UNSEGMENTED && inputSize > manager.getDataFieldSize()){
+      std::cerr << "[ Error " << INVALID_INPUT_DATA << " ]: "<<  "Input data is too big for unsegmented packets, data "
+      << inputSize << " must be less than defined data packet length of " << manager.getDataFieldSize() << std::endl ;
+      return INVALID_INPUT_DATA;
+    }
+    if (const auto res = streamEncode(appName, manager, input, inputSize, output); !res.has_value()) {
+      std::remove(output.c_str()); // do not leave a partial output behind.
+      std::cerr << "[ Error " << res.error().code() << " ]: "<<  res.error().message() << std::endl ;
+      return res.error().code();
+    }
+    const auto end = std::chrono::high_resolution_clock::now();
+    const auto duration = std::chrono::duration_cast<std::chrono::microseconds>(end - start);
+    customConsole(appName,"execution time: " + std::to_string(duration.count()) + " [us]");
+    customConsole(appName,"[ Exit code 0 ]");
+    return 0;
+  }
+
   std::vector<std::uint8_t> inputBytes;
   customConsole(appName,"reading data from " + input);
 
@@ -11,6 +11,8 @@
 #include <iomanip>
 #include <chrono>
 #include <set>
+#include <cstring>
+#include <algorithm>
 
 CCSDS::ResultBool parseArguments(const std::int32_t argc, char *argv[],
                                  std::unordered_map<std::string, std::string> &allowedMap,
@@ -32,20 +34,26 @@ CCSDS::ResultBool parseArguments(const std::int32_t argc, char *argv[],
         key = current.substr(2);
       }else {
         std::string sKey = current.substr(1);
-        RET_IF_ERR_MSG(allowedShortKeys.find(sKey) == allowedShortKeys.end(), static_cast<CCSDS::ErrorCode>(ARG_PARSE_ERROR), "Unknown argument: -" + sKey);
+        if (allowedShortKeys.find(sKey) == allowedShortKeys.end()) {
+          return CCSDS::Error{ static_cast<CCSDS::ErrorCode>(ARG_PARSE_ERROR), "Unknown argument" }.withIndex(i);
+        }
         key = allowedMap.at(sKey);
       }
-      RET_IF_ERR_MSG(allowedKeys.find(key) == allowedKeys.end(), static_cast<CCSDS::ErrorCode>(ARG_PARSE_ERROR), "Unknown argument: --" + key);
+      if (allowedKeys.find(key) == allowedKeys.end()) {
+        return CCSDS::Error{ static_cast<CCSDS::ErrorCode>(ARG_PARSE_ERROR), "Unknown argument" }.withIndex(i);
+      }
 
       if (booleanArgs.find(key) != booleanArgs.end()) {
         outArgs[key] = "true";
       }else {
-        RET_IF_ERR_MSG(i + 1 >= argc, static_cast<CCSDS::ErrorCode>(ARG_PARSE_ERROR), "Missing value for argument: --" + key);
+        if (i + 1 >= argc) {
+          return CCSDS::Error{ static_cast<CCSDS::ErrorCode>(ARG_PARSE_ERROR), "Missing value for argument" }.withIndex(i);
+        }
         const std::string value = argv[++i];
         outArgs[key] = value;
       }
     }else {
-      return CCSDS::Error{ static_cast<CCSDS::ErrorCode>(ARG_PARSE_ERROR), "Unknown argument:" + std::string(argv[i]) };
+      return CCSDS::Error{ static_cast<CCSDS::ErrorCode>(ARG_PARSE_ERROR), "Unknown argument" }.withIndex(i);
     }
   }
   return true;
@@ -72,3 +80,78 @@ void customConsole(const std::string& appName, const std::string& message, const
             << "[" << logLevel << "] : "
             << message << std::endl;
 }
+
+CCSDS::ResultBool readFileChunks(const std::string& filename, const std::size_t chunkSize,
+                                 const std::function<CCSDS::ResultBool(const std::uint8_t*, std::size_t)>& consumer) {
+  RET_IF_ERR_MSG(filename.empty(), CCSDS::ErrorCode::FILE_READ_ERROR, "No filename provided");
+  RET_IF_ERR_MSG(chunkSize == 0, CCSDS::ErrorCode::FILE_READ_ERROR, "Invalid chunk size");
+  std::ifstream in(filename, std::ios::binary);
+  RET_IF_ERR_MSG(!in, CCSDS::ErrorCode::FILE_READ_ERROR, "Failed to open file for reading");
+
+  std::vector<std::uint8_t> chunk(chunkSize);
+  while (in) {
+    in.read(reinterpret_cast<char*>(chunk.data()), static_cast<std::streamsize>(chunk.size()));
+    const auto bytesRead = static_cast<std::size_t>(in.gcount());
+    RET_IF_ERR_MSG(in.bad(), CCSDS::ErrorCode::FILE_READ_ERROR, "Failed to read the data from the file");
+    if (bytesRead == 0) {
+      break;
+    }
+    FORWARD_RESULT(consumer(chunk.data(), bytesRead));
+  }
+  return true;
+}
+
+BufferedFileWriter::~BufferedFileWriter() {
+  if (m_out.is_open()) {
+    (void) close();
+  }
+}
+
+CCSDS::ResultBool BufferedFileWriter::open(const std::string& filename) {
+  RET_IF_ERR_MSG(filename.empty(), CCSDS::ErrorCode::FILE_WRITE_ERROR, "No filename provided");
+  m_out.open(filename, std::ios::binary | std::ios::trunc);
+  RET_IF_ERR_MSG(!m_out, CCSDS::ErrorCode::FILE_WRITE_ERROR, "Failed to open file for writing");
+  m_bufferUsed = 0;
+  m_bytesWritten = 0;
+  return true;
+}
+
+CCSDS::ResultBool BufferedFileWriter::write(const std::uint8_t* pData, std::size_t sizeData) {
+  RET_IF_ERR_MSG(!m_out.is_open(), CCSDS::ErrorCode::FILE_WRITE_ERROR, "File is not open for writing");
+  m_bytesWritten += sizeData;
+  while (sizeData > 0) {
+    if (m_bufferUsed == 0 && sizeData >= m_buffer.size()) {
+      // whole blocks bypass the buffer.
+      m_out.write(reinterpret_cast<const char*>(pData), static_cast<std::streamsize>(sizeData));
+      RET_IF_ERR_MSG(!m_out, CCSDS::ErrorCode::FILE_WRITE_ERROR, "Failed to write the data to the file");
+      return true;
+    }
+    const std::size_t copySize = std::min(sizeData, m_buffer.size() - m_bufferUsed);
+    std::memcpy(m_buffer.data() + m_bufferUsed, pData, copySize);
+    m_bufferUsed += copySize;
+    pData += copySize;
+    sizeData -= copySize;
+    if (m_bufferUsed == m_buffer.size()) {
+      FORWARD_RESULT(flush());
+    }
+  }
+  return true;
+}
+
+CCSDS::ResultBool BufferedFileWriter::close() {
+  RET_IF_ERR_MSG(!m_out.is_open(), CCSDS::ErrorCode::FILE_WRITE_ERROR, "File is not open for writing");
+  const auto res = flush();
+  m_out.close();
+  FORWARD_RESULT(res);
+  RET_IF_ERR_MSG(!m_out, CCSDS::ErrorCode::FILE_WRITE_ERROR, "Failed to close the file");
+  return true;
+}
+
+CCSDS::ResultBool BufferedFileWriter::flush() {
+  if (m_bufferUsed != 0) {
+    m_out.write(reinterpret_cast<const char*>(m_buffer.data()), static_cast<std::streamsize>(m_bufferUsed));
+    m_bufferUsed = 0;
+    RET_IF_ERR_MSG(!m_out, CCSDS::ErrorCode::FILE_WRITE_ERROR, "Failed to write the data to the file");
+  }
+  return true;
+}
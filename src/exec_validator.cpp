@@ -12,6 +12,7 @@
 #include <iostream>
 #include <chrono>
 #include <fstream>
+#include <future>
 #include <sstream>
 #include "CCSDSPack.h"
 #include "exec_utils.h"
@@ -46,6 +47,9 @@ void printHelp() {
   std::cout << " -h or --help              : Show this help and message" << std::endl;
   std::cout << " -v or --verbose           : Show packet specific report" << std::endl;
   std::cout << " -p or --print-packets     : Show generated packets information" << std::endl;
+  std::cout << " -r or --report <filename> : Write the packet reports to a file as they are validated" << std::endl;
+  std::cout << " -f or --format <format>   : Report file format, text (default) or jsonl" << std::endl;
+  std::cout << " -m or --max-failures <n>  : Failed packets listed in the summary (default 100)" << std::endl;
   std::cout << std::endl;
   std::cout << "Note : If config file is provided, the loaded packets are validated against the the template packet." << std::endl;
   std::cout << std::endl;
@@ -108,6 +112,44 @@ void stripAnsiCodes(std::string& input) {
   input = std::move(output);
 }
 
+/**
+ * Input chunk size of the streaming validation, packets are validated one chunk at a time.
+ */
+constexpr std::size_t kValidatorChunkSize = 1 << 20;
+
+/**
+ * Names of the report checks, in report order, as written in the JSON lines report.
+ */
+const std::vector<std::string> kCheckNames{
+  "dataFieldLength", "crc", "sequenceFlags", "sequenceCount", "identification", "templateSequence"
+};
+
+/**
+ * Aggregate results of a validation run, only the first failures are kept.
+ */
+struct ValidationSummary {
+  std::uint64_t packets{0};
+  std::uint64_t failedPackets{0};
+  std::vector<std::uint64_t> failedChecks = std::vector<std::uint64_t>(kCheckNames.size(), 0); ///< failures per check.
+  std::vector<std::uint64_t> failures{};   ///< ids of the first failed packets, bounded by the maximum failures.
+};
+
+/**
+ * Returns the report of a packet as a JSON line.
+ */
+std::string jsonReport(const std::uint64_t packetId, const std::uint64_t offset, const CCSDS::PacketView &view,
+                       const std::vector<bool> &report, const bool passed, const bool validateAgainstTemplate) {
+  std::string line = "{\"packet\":" + std::to_string(packetId) + ",\"offset\":" + std::to_string(offset) +
+                     ",\"apid\":" + std::to_string(view.getAPID()) +
+                     ",\"sequenceCount\":" + std::to_string(view.getSequenceCount()) +
+                     ",\"passed\":" + (passed ? "true" : "false") + ",\"checks\":{";
+  const std::size_t checks = validateAgainstTemplate ? kCheckNames.size() : 4;
+  for (std::size_t check = 0; check < checks; ++check) {
+    line += (check == 0 ? "\"" : ",\"") + kCheckNames[check] + "\":" + (report[check] ? "true" : "false");
+  }
+  return line + "}}\n";
+}
+
 int main(const int argc, char* argv[]) {
   std::string appName = "ccsds_validator";
 
@@ -117,6 +159,9 @@ int main(const int argc, char* argv[]) {
   allowed.insert({"i", "input"});
   allowed.insert({"c", "config"});
   allowed.insert({"p", "print-packets"});
+  allowed.insert({"r", "report"});
+  allowed.insert({"f", "format"});
+  allowed.insert({"m", "max-failures"});
 
   const std::set<std::string> booleanArgs{"verbose", "help", "print-packets"};
 
@@ -127,7 +172,7 @@ int main(const int argc, char* argv[]) {
 
   const auto start = std::chrono::high_resolution_clock::now();
   if (const auto res = parseArguments(argc, argv, allowed, args, booleanArgs); !res.has_value()) {
-    std::cerr << "[ Error " << res.error().code() << " ]: "<<  res.error().message() << std::endl ;
+    std::cerr << "[ Error " << res.error().code() << " ]: "<<  res.error().text() << ": " << argv[res.error().index()] << std::endl ;
     return res.error().code();
   }
    // std::cout << "Parsed args:\n";
@@ -152,28 +197,27 @@ int main(const int argc, char* argv[]) {
   }
   const std::string input{args["input"]};
 
-  CCSDS::Manager manager;
-  CCSDS::Validator validator;
-  std::vector<uint8_t> inputBytes;
-  bool isConfigProvided{false};
-
-  manager.setAutoValidateEnable(false);
-  manager.setDataFieldSize(64*1023 ); // 1M Bytes * packet
-  manager.setAutoUpdateEnable(false);
-  customConsole(appName,"reading data from " + input);
-  if (const auto res = readBinaryFile(input); !res.has_value()) {
-    std::cerr << "[ Error " << res.error().code() << " ]: "<<  res.error().message() << std::endl ;
-    return res.error().code();
-  }else {
-    inputBytes = res.value();
+  // report settings
+  const std::string reportFile{args.find("report") != args.end() ? args["report"] : ""};
+  const std::string reportFormat{args.find("format") != args.end() ? args["format"] : "text"};
+  if (reportFormat != "text" && reportFormat != "jsonl") {
+    std::cerr << "[ Error " << ARG_PARSE_ERROR << " ]: " << "Report format must be text or jsonl" << std::endl;
+    return ARG_PARSE_ERROR;
   }
-
-  customConsole(appName, "deserializing CCSDS packets from file");
-  if (const auto res = manager.load(inputBytes); !res.has_value()) {
-    std::cerr << "[ Error " << res.error().code() << " ]: "<<  res.error().message() << std::endl ;
-    return res.error().code();
+  std::size_t maxFailures{100};
+  if (args.find("max-failures") != args.end()) {
+    try {
+      maxFailures = std::stoul(args["max-failures"]);
+    } catch (const std::exception &) {
+      std::cerr << "[ Error " << ARG_PARSE_ERROR << " ]: " << "Maximum failures must be a number" << std::endl;
+      return ARG_PARSE_ERROR;
+    }
   }
 
+  CCSDS::Validator validator;
+  CCSDS::StreamDecoder decoder;
+  bool isConfigProvided{false};
+
   // config argument specified
   if (args.find("config") != args.end()) {
     isConfigProvided = true;
@@ -196,58 +240,207 @@ int main(const int argc, char* argv[]) {
     CCSDS::Packet templatePacket;
     templatePacket.loadFromConfig(cfg);
     validator.setTemplatePacket(templatePacket);
-    validator.configure(true,true,true);
+
+    if (cfg.isKey("sync_pattern_enable")) {
+      bool syncPatternEnable{false};
+      ASSIGN_CONFIG_OR_PRINT(syncPatternEnable, cfg, bool, "sync_pattern_enable");
+      decoder.setSyncPatternEnable(syncPatternEnable);
+      if (syncPatternEnable && cfg.isKey("sync_pattern")) {
+        std::uint32_t syncPattern{0x1ACFFC1D};
+        ASSIGN_CONFIG_OR_PRINT(syncPattern, cfg, int, "sync_pattern");
+        decoder.setSyncPattern(syncPattern);
+      }
+      if (syncPatternEnable && cfg.isKey("sync_pattern_resync")) {
+        bool resyncEnable{false};
+        ASSIGN_CONFIG_OR_PRINT(resyncEnable, cfg, bool, "sync_pattern_resync");
+        decoder.setResyncEnable(resyncEnable);
+      }
+    }
   }// end if config provided
 
-  validator.configure(true,true,false);
+  validator.configure(true, true, isConfigProvided);
+  // stateless checks run over all hardware threads, sequence counts are checked in order.
+  validator.setThreadCount(0);
 
-  if (verbose) customConsole(appName,"printing data to screen:");
+  BufferedFileWriter reportWriter;
+  if (!reportFile.empty()) {
+    customConsole(appName, "writing " + reportFormat + " reports to " + reportFile);
+    if (const auto res = reportWriter.open(reportFile); !res.has_value()) {
+      std::cerr << "[ Error " << res.error().code() << " ]: "<<  res.error().message() << std::endl ;
+      return res.error().code();
+    }
+  }
 
-  std::vector<std::vector<bool>> reports;
-  std::string reportsStream;
-  bool overallResult{true};
-  std::int32_t packetIndex{1};
-  std::vector<int> failedPackets;
   const bool printPackets{args["print-packets"] == "true"};
+  if (verbose) customConsole(appName,"printing data to screen:");
 
-  for (auto &packet : manager.getPackets()) {
-    if (verbose) std::cout << "[ CCSDS VALIDATOR ] Printing Packet [ " << packetIndex << " ]: " << std::endl;
-    reportsStream += "[ CCSDS VALIDATOR ] Packet report for id: [ " + std::to_string(packetIndex) + " ]\n";
-    if (printPackets) printPacket(packet);
-    validator.validate(packet);
-    auto report = validator.getReport();
-    reports.emplace_back(report);
+  ValidationSummary summary;
+  std::uint64_t nextOffset{0};     // file offset following the last packet.
+  std::uint64_t skippedBytes{0};   // bytes skipped by the decoder up to the last packet.
+  const std::uint64_t syncSize{decoder.getSyncPatternEnable() ? 4u : 0u};
+
+  // handles the report of a validated packet, reports are written out and only counters are kept.
+  auto reportPacket = [&](const CCSDS::PacketView &view, const std::uint64_t offset,
+                          const std::vector<bool> &report) -> CCSDS::ResultBool {
+    const std::uint64_t packetId = ++summary.packets;
     bool currentResult{false};
-    std::string appendReport = printReport(report,currentResult, isConfigProvided);
-    overallResult = overallResult && currentResult;
-    reportsStream += appendReport;
-    if (verbose) std::cout << appendReport << std::endl;
-    if (verbose) std::cout << "[ CCSDS VALIDATOR ] Packet Result [ ";
-    if (verbose && currentResult) std::cout << GREEN;
-    else if (verbose) {
-      std::cout << RED;
+    std::string appendReport = printReport(report, currentResult, isConfigProvided);
+    if (!currentResult) {
+      summary.failedPackets++;
+      for (std::size_t check = 0; check < report.size() && check < summary.failedChecks.size(); ++check) {
+        summary.failedChecks[check] += report[check] ? 0 : 1;
+      }
+      if (summary.failures.size() < maxFailures) {
+        summary.failures.push_back(packetId);
+      }
+    }
+    if (verbose) {
+      std::cout << "[ CCSDS VALIDATOR ] Printing Packet [ " << packetId << " ]: " << std::endl;
+      std::cout << appendReport << std::endl;
+      std::cout << "[ CCSDS VALIDATOR ] Packet Result [ " << (currentResult ? GREEN + "PASSED" : RED + "FAILED")
+                << RESET << " ]" << std::endl;
+    }
+    if (printPackets) {
+      CCSDS::Packet packet;
+      packet.setUpdatePacketEnable(false);
+      if (packet.deserialize(view).has_value()) printPacket(packet);
+    }
+    if (!reportFile.empty()) {
+      std::string line;
+      if (reportFormat == "jsonl") {
+        line = jsonReport(packetId, offset, view, report, currentResult, isConfigProvided);
+      } else {
+        stripAnsiCodes(appendReport);
+        line = "[ CCSDS VALIDATOR ] Packet report for id: [ " + std::to_string(packetId) + " ]\n" + appendReport;
+      }
+      FORWARD_RESULT(reportWriter.write(reinterpret_cast<const std::uint8_t *>(line.data()), line.size()));
     }
-    if (verbose && currentResult) std::cout <<  "PASSED" ;
-    else if (verbose) {
-      std::cout << "FAILED";
+    return true;
+  };
+
+  // locates the packet of a view in the file, views of a chunk are exact, a packet carried over from the
+  // previous chunk follows the last packet and the bytes skipped since.
+  auto locatePacket = [&](const CCSDS::PacketView &view, const std::uint8_t *pChunk, const std::size_t chunkSize,
+                          const std::uint64_t chunkOffset) {
+    const std::uint8_t *pPacket = view.getBytes().data;
+    std::uint64_t offset;
+    if (pPacket >= pChunk && pPacket < pChunk + chunkSize) {
+      offset = chunkOffset + static_cast<std::uint64_t>(pPacket - pChunk);
+    } else {
+      offset = nextOffset + (decoder.getSkippedBytes() - skippedBytes) + syncSize;
     }
-    if (verbose) std::cout << RESET << " ]" << std::endl;
-    if (!currentResult) failedPackets.push_back(packetIndex);
-    packetIndex++;
+    skippedBytes = decoder.getSkippedBytes();
+    nextOffset = offset + view.getBytes().size;
+    return offset;
+  };
+
+  customConsole(appName, "validating CCSDS packets from " + input);
+  std::ifstream in(input, std::ios::binary);
+  if (!in) {
+    std::cerr << "[ Error " << CCSDS::FILE_READ_ERROR << " ]: " << "Failed to open file for reading" << std::endl;
+    return CCSDS::FILE_READ_ERROR;
   }
+  // two chunk buffers, the next chunk is read while the current one is validated.
+  std::vector<std::uint8_t> chunks[2]{std::vector<std::uint8_t>(kValidatorChunkSize),
+                                      std::vector<std::uint8_t>(kValidatorChunkSize)};
+  auto readChunk = [&in](std::vector<std::uint8_t> &chunk) {
+    in.read(reinterpret_cast<char *>(chunk.data()), static_cast<std::streamsize>(chunk.size()));
+    return static_cast<std::size_t>(in.gcount());
+  };
+  std::vector<CCSDS::PacketView> batch;
+  std::vector<std::uint64_t> batchOffsets;
+  std::uint64_t chunkOffset{0};
+  std::size_t current{0};
+  std::size_t chunkSize = readChunk(chunks[current]);
+  while (chunkSize > 0) {
+    auto nextChunk = std::async(std::launch::async, readChunk, std::ref(chunks[current ^ 1]));
+    const std::uint8_t *pChunk = chunks[current].data();
+    decoder.push(pChunk, chunkSize);
 
-  if (!failedPackets.empty() && verbose) {
-    std::string failedPacketsStream;
-    failedPacketsStream = "[ CCSDS VALIDATOR ] Packets failed validation: [ ";
-    for (const auto& packetID : failedPackets) {
-      failedPacketsStream += std::to_string(packetID) + " ";
+    batch.clear();
+    batchOffsets.clear();
+    CCSDS::PacketView view;
+    auto res = decoder.next(view);
+    while (res.has_value() && res.value()) {
+      const auto offset = locatePacket(view, pChunk, chunkSize, chunkOffset);
+      if (view.getBytes().data >= pChunk && view.getBytes().data < pChunk + chunkSize) {
+        batch.push_back(view);
+        batchOffsets.push_back(offset);
+      } else if (const auto reported = reportPacket(view, offset, (validator.validate(view), validator.getReport()));
+                 !reported.has_value()) {
+        // a packet carried over from the previous chunk comes first and is only valid until the next call.
+        res = reported.error();
+        break;
+      }
+      res = decoder.next(view);
+    }
+    if (res.has_value()) {
+      validator.validateAll(batch);
+      for (std::size_t index = 0; index < batch.size() && res.has_value(); ++index) {
+        if (const auto reported = reportPacket(batch[index], batchOffsets[index], validator.getReports()[index]);
+            !reported.has_value()) {
+          res = reported.error();
+        }
+      }
     }
-    failedPacketsStream += "]\n" ;
-    std::cout << failedPacketsStream << std::endl;
-    reportsStream += failedPacketsStream;
+    chunkOffset += chunkSize;
+    current ^= 1;
+    chunkSize = nextChunk.get();
+    if (!res.has_value()) {
+      std::cerr << "[ Error " << res.error().code() << " ]: "<<  res.error().message() << std::endl ;
+      return res.error().code();
+    }
+  }
+  if (in.bad()) {
+    std::cerr << "[ Error " << CCSDS::FILE_READ_ERROR << " ]: " << "Failed to read the data from the file" << std::endl;
+    return CCSDS::FILE_READ_ERROR;
+  }
+  if (decoder.getResyncEnable() && decoder.getSyncPatternEnable()) {
+    decoder.skipBuffered();
+  }
+  if (decoder.getBufferedBytes() != 0) {
+    std::cerr << "[ Error " << CCSDS::INVALID_DATA << " ]: " << "Packet truncated, stream ends before the declared data length." << std::endl;
+    return CCSDS::INVALID_DATA;
   }
+  if (summary.packets == 0) {
+    std::cerr << "[ Error " << CCSDS::NO_DATA << " ]: " << "No packets found in " << input << std::endl;
+    return CCSDS::NO_DATA;
+  }
+
+  const bool overallResult{summary.failedPackets == 0};
   std::string resultString = (overallResult) ? GREEN + "PASSED" + RESET : RED + "FAILED" + RESET;
-  reportsStream += "[ CCSDS VALIDATOR ] Packets validation [" + resultString + "]";
+  customConsole(appName, "validated " + std::to_string(summary.packets) + " packets, " +
+                std::to_string(summary.failedPackets) + " failed");
+  if (!overallResult) {
+    std::string failedChecks;
+    for (std::size_t check = 0; check < kCheckNames.size(); ++check) {
+      if (summary.failedChecks[check] != 0) {
+        failedChecks += " " + kCheckNames[check] + ": " + std::to_string(summary.failedChecks[check]);
+      }
+    }
+    customConsole(appName, "failed checks:" + failedChecks);
+    std::string failedPacketsStream = "Packets failed validation: [ ";
+    for (const auto& packetID : summary.failures) {
+      failedPacketsStream += std::to_string(packetID) + " ";
+    }
+    failedPacketsStream += summary.failures.size() < summary.failedPackets ? "... ]" : "]";
+    customConsole(appName, failedPacketsStream);
+  }
+  if (!reportFile.empty()) {
+    std::string line;
+    if (reportFormat == "jsonl") {
+      line = "{\"summary\":{\"packets\":" + std::to_string(summary.packets) + ",\"failedPackets\":" +
+             std::to_string(summary.failedPackets) + ",\"passed\":" + (overallResult ? "true" : "false") + "}}\n";
+    } else {
+      line = "[ CCSDS VALIDATOR ] Packets validation [" + std::string(overallResult ? "PASSED" : "FAILED") + "]\n";
+    }
+    auto res = reportWriter.write(reinterpret_cast<const std::uint8_t *>(line.data()), line.size());
+    if (res.has_value()) res = reportWriter.close();
+    if (!res.has_value()) {
+      std::cerr << "[ Error " << res.error().code() << " ]: "<<  res.error().message() << std::endl ;
+      return res.error().code();
+    }
+  }
   customConsole(appName,"Packets validation [" + resultString + "]");
 
 
@@ -31,5 +31,13 @@ void testGroupValidator(TestManager *tester, const std::string &description);
 void testGroupManagement(TestManager *tester, const std::string &description);
 void testGroupEdgeCases(TestManager *tester, const std::string &description);
 
+/**
+ * testGroupStreaming : A group of unit tests that perform incremental stream decoding functionalities of the system.
+ *
+ * @param tester
+ * @param description
+ */
+void testGroupStreaming(TestManager *tester, const std::string &description);
+
 
 #endif //TESTS_H
@@ -18,7 +18,7 @@ public:
   [[nodiscard]] CCSDS::ResultBool deserialize(const std::vector<uint8_t> &data) override {m_data = data; return true;};
 
   [[nodiscard]] uint16_t getSize() const override { return m_data.size(); }
-  [[nodiscard]] std::string getType() const override { return m_type; }
+  [[nodiscard]] std::string_view getType() const override { return m_type; }
 
   [[nodiscard]] std::vector<uint8_t> serialize() const override {return m_data;};
   void update(CCSDS::DataField* dataField) override {m_dataLength = m_data.size();}
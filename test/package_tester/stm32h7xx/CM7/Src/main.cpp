@@ -78,7 +78,7 @@ public:
 	[[nodiscard]] uint16_t getSize() const override {
 		return m_data.size();
 	}
-	[[nodiscard]] std::string getType() const override {
+	[[nodiscard]] std::string_view getType() const override {
 		return m_type;
 	}
 
@@ -5,6 +5,7 @@
 #include <iostream>
 #include "CCSDSUtils.h"
 #include "CCSDSConfig.h"
+#include "CCSDSMappedFile.h"
 #include "CCSDSResult.h"
 #include "tests.h"
 #include "PusServices.h"
@@ -23,7 +24,7 @@ class TestSecondaryHeader final : public CCSDS::SecondaryHeaderAbstract {
   [[nodiscard]] CCSDS::ResultBool deserialize(const std::vector<std::uint8_t> &data) override {m_data = data; return true;};
 
   [[nodiscard]] std::uint16_t getSize() const override { return m_data.size(); }
-  [[nodiscard]] std::string getType() const override { return m_type; }
+  [[nodiscard]] std::string_view getType() const override { return m_type; }
 
   [[nodiscard]] std::vector<std::uint8_t> serialize() const override {return m_data;};
   void update(CCSDS::DataField* dataField) override {m_dataLength = m_data.size();}
@@ -35,6 +36,18 @@ class TestSecondaryHeader final : public CCSDS::SecondaryHeaderAbstract {
   const std::string m_type = "TestSecondaryHeader";
 };
 
+/** bitwise CRC-16 reference the table driven engine is checked against. */
+static std::uint16_t referenceCrc16(const std::vector<std::uint8_t> &data, const CCSDS::CRC16Config &config) {
+  std::uint16_t crc = config.initialValue;
+  for (const auto &byte: data) {
+    crc ^= static_cast<std::uint16_t>(byte) << 8;
+    for (std::int32_t i = 0; i < 8; ++i) {
+      crc = (crc & 0x8000) ? (crc << 1) ^ config.polynomial : crc << 1;
+    }
+  }
+  return crc ^ config.finalXorValue;
+}
+
 void testGroupCore(TestManager *tester, const std::string &description) {
   std::cout << "  testGroupCore: " << description << std::endl;
 
@@ -495,6 +508,23 @@ void testGroupCore(TestManager *tester, const std::string &description) {
       return std::equal(expected.begin(), expected.end(), ret.begin());
     });
 
+  tester->unitTest("Serialize PUS-C packet into a caller buffer, shall match serialize and reject small buffers.", [] {
+    CCSDS::Packet packet;
+    TEST_VOID(
+      packet.deserialize({0xF7, 0xFF, 0xc0, 0x00, 0x00, 0x05, 0x1, 0x4, 0x5, 0x06, 0x00, 0xBF, 0x00, 0xBF, 0x01, 0x02, 0x03, 0x04,
+        0x05, 0x01, 0x02}, "PusC", 10));
+    const auto expected = packet.serialize();
+    std::uint8_t buffer[32]{};
+    std::size_t written{0};
+    TEST_RET(written, packet.serializeInto(buffer, sizeof(buffer)));
+    bool res = written == expected.size() && std::equal(expected.begin(), expected.end(), buffer);
+    TEST_VOID_ERR(packet.serializeInto(buffer, expected.size() - 1));
+    std::vector<std::uint8_t> appended{0xAA};
+    TEST_RET(written, packet.serializeInto(appended));
+    res &= appended.size() == expected.size() + 1 && std::equal(expected.begin(), expected.end(), appended.begin() + 1);
+    return res;
+  });
+
   tester->unitTest("Write binary data to a file.",[] {
       const std::vector<std::uint8_t> data{
         0xFF, 0xFF, 0xc0, 0x00, 0x00, 0x0b, 0x1, 0x4, 0x5, 0x06, 0x07, 0xa, 0x00, 0x03, 0x03, 0x04, 0x05, 0x97, 0xdf,
@@ -521,6 +551,22 @@ void testGroupCore(TestManager *tester, const std::string &description) {
       return std::equal(expected.begin(), expected.end(), ret.begin());
     });
 
+  tester->unitTest("Memory map binary data from file.",[] {
+      std::vector<std::uint8_t> expected;
+      TEST_RET(expected, readBinaryFile("test_resources/binaryFile.bin"));
+      CCSDS::MappedFile file;
+      TEST_VOID(file.open("test_resources/binaryFile.bin"));
+      bool res = file.isOpen() && file.view().toVector() == expected;
+      TEST_VOID_ERR(file.open("test_resources/missingFile.bin"));
+      res &= !file.isOpen() && file.data() == nullptr;
+      return res;
+    });
+
+  tester->unitTest("File existence check shall only accept regular files.",[] {
+      return fileExists("test_resources/binaryFile.bin") && !fileExists("test_resources/missingFile.bin") &&
+             !fileExists("test_resources") && !fileExists("");
+    });
+
   tester->unitTest("Read data from configure file.",[] {
     Config cfg;
     bool ret{false};
@@ -694,5 +740,255 @@ void testGroupCore(TestManager *tester, const std::string &description) {
     return std::equal(expected.begin(), expected.end(), res.begin());
   });
 
+  tester->unitTest("Packet update shall refresh the sequence without touching the CRC and recompute it on CRC changes.",[] {
+    CCSDS::Packet packet;
+    packet.setPrimaryHeader(CCSDS::PrimaryHeader{0, 1, 0, 0x7F4, CCSDS::FIRST_SEGMENT, 1, 0});
+    TEST_VOID(packet.setApplicationData({0x01, 0x02, 0x03, 0x04}));
+    const auto crc = packet.getCRC();
+    TEST_VOID(packet.setSequenceCount(5));
+    if (packet.getPrimaryHeader().getSequenceCount() != 5 || packet.getCRC() != crc) return false;
+    if (packet.getPrimaryHeader().getDataLength() != 4) return false;
+    packet.setCrcConfig(0x8005, 0x0000, 0x0000);
+    const std::vector<std::uint8_t> data{0x01, 0x02, 0x03, 0x04};
+    return packet.getCRC() == crc16(data, 0x8005, 0x0000, 0x0000);
+  });
+
+  tester->unitTest("Secondary header factory shall assign type ids in registration order and create new instances.",[] {
+    CCSDS::DataField df;
+    TEST_VOID(df.RegisterSecondaryHeader<TestSecondaryHeader>());
+    const auto &factory = df.getDataFieldHeaderFactory();
+    if (factory.getTypeId("DataOnlyHeader") != CCSDS::BUFFER_HEADER_TYPE_ID) return false;
+    if (factory.getTypeId("PusA") != CCSDS::PUSA_TYPE_ID) return false;
+    if (factory.getTypeId("PusC") != CCSDS::PUSC_TYPE_ID) return false;
+    if (factory.getTypeId("TestSecondaryHeader") != 4) return false;
+    if (factory.getTypeId("Unknown") != CCSDS::INVALID_TYPE_ID) return false;
+    const auto first = factory.create(CCSDS::PUSB_TYPE_ID);
+    const auto second = factory.create("PusB");
+    return first && second && first != second && first->getType() == "PusB";
+  });
+
+  tester->unitTest("Secondary header registry shall be shared by every data field and keep the first registration.",[] {
+    TEST_VOID(CCSDS::Packet::RegisterSecondaryHeader<TestSecondaryHeader>());
+    const auto typeId = CCSDS::SecondaryHeaderFactory::instance().getTypeId("TestSecondaryHeader");
+    CCSDS::DataField df;
+    TEST_VOID(df.RegisterSecondaryHeader<TestSecondaryHeader>());
+    if (df.getDataFieldHeaderFactory().getTypeId("TestSecondaryHeader") != typeId) return false;
+    TEST_VOID(df.setDataFieldHeader({0x77, 0xFA, 0xB, 0x0, 0x0, 0xB, 0x5}, "TestSecondaryHeader"));
+
+    CCSDS::SecondaryHeaderFactory local;
+    TEST_VOID(local.registerType<PusC>());
+    return typeId != CCSDS::INVALID_TYPE_ID && &df.getDataFieldHeaderFactory() == &CCSDS::SecondaryHeaderFactory::instance() &&
+           local.getTypeId("PusC") == 0 && !local.typeIsRegistered("PusA") && df.getDataFieldHeaderBytes().size() == 7;
+  });
+
+  tester->unitTest("Secondary header factory shall reject a type name registered again with a different layout.",[] {
+    CCSDS::SecondaryHeaderFactory local;
+    TEST_VOID(local.registerType<TestSecondaryHeader>());
+    TEST_VOID(local.registerType<TestSecondaryHeader>());
+    const auto res = local.registerType(std::make_shared<TestSecondaryHeader>(std::vector<std::uint8_t>{0x1, 0x2, 0x3}));
+    const auto header = local.create("TestSecondaryHeader");
+    return !res.has_value() && res.error().code() == CCSDS::ErrorCode::INVALID_SECONDARY_HEADER_DATA &&
+           local.getTypeId("TestSecondaryHeader") == 0 && !local.typeIsRegistered(CCSDS::SecondaryHeaderTypeId{1}) && header && header->getSize() == 0;
+  });
+
+  tester->unitTest("Packets deserialized with the same header type shall not share the secondary header.",[] {
+    const std::vector<std::uint8_t> first{
+      0xFF, 0xFF, 0xc0, 0x00, 0x00, 0x0b, 0x1, 0x4, 0x5, 0x06, 0x00, 0x5, 0x01, 0x02, 0x03, 0x04, 0x05, 0x97, 0x7d};
+    const std::vector<std::uint8_t> second{
+      0xFF, 0xFF, 0xc0, 0x00, 0x00, 0x0b, 0x1, 0x7, 0x8, 0x09, 0x00, 0x5, 0x01, 0x02, 0x03, 0x04, 0x05, 0x00, 0x00};
+    CCSDS::Packet packet;
+    packet.setUpdatePacketEnable(false);
+    TEST_VOID(packet.deserialize(first, CCSDS::PUSA_TYPE_ID));
+    CCSDS::Packet copy = packet;
+    TEST_VOID(copy.deserialize(second, "PusA"));
+    const auto header = std::dynamic_pointer_cast<PusA>(packet.getDataField().getSecondaryHeader());
+    const auto headerCopy = std::dynamic_pointer_cast<PusA>(copy.getDataField().getSecondaryHeader());
+    return header && headerCopy && header != headerCopy &&
+           header->getServiceType() == 0x4 && headerCopy->getServiceType() == 0x7;
+  });
+
+  tester->unitTest("Inline PUS-A header shall be copied with the packet and serialize as before.",[] {
+    const std::vector<std::uint8_t> expected{
+      0xFF, 0xFF, 0xc0, 0x00, 0x00, 0x0b, 0x1, 0x4, 0x5, 0x06, 0x00, 0x5, 0x01, 0x02, 0x03, 0x04, 0x05, 0x97, 0x7d};
+    CCSDS::Packet packet;
+    packet.setUpdatePacketEnable(false);
+    TEST_VOID(packet.deserialize(expected, CCSDS::PUSA_TYPE_ID));
+    CCSDS::Packet copy = packet;
+    TEST_VOID(copy.setDataFieldHeader({0x1, 0x7, 0x8, 0x09, 0x00, 0x5}, "PusA"));
+    const auto header = packet.getDataField().getSecondaryHeader();
+    const auto headerCopy = copy.getDataField().getSecondaryHeader();
+    if (header == headerCopy || header->serialize()[1] != 0x4 || headerCopy->serialize()[1] != 0x7) return false;
+    const auto res = packet.serialize();
+    return std::equal(expected.begin(), expected.end(), res.begin());
+  });
+
+  tester->unitTest("Secondary header pointer of an inline PUS-A header shall own the header beyond the packet.",[] {
+    const std::vector<std::uint8_t> data{
+      0xFF, 0xFF, 0xc0, 0x00, 0x00, 0x0b, 0x1, 0x4, 0x5, 0x06, 0x00, 0x5, 0x01, 0x02, 0x03, 0x04, 0x05, 0x97, 0x7d};
+    std::shared_ptr<CCSDS::SecondaryHeaderAbstract> header;
+    {
+      CCSDS::Packet packet;
+      packet.setUpdatePacketEnable(false);
+      TEST_VOID(packet.deserialize(data, CCSDS::PUSA_TYPE_ID));
+      header = packet.getDataField().getSecondaryHeader();
+      TEST_VOID(packet.setDataFieldHeader({0x1, 0x7, 0x8, 0x09, 0x00, 0x5}, "PusA"));
+      const auto res = packet.serialize();
+      if (res[7] != 0x7 || header.use_count() != 1) return false;
+    }
+    return header.use_count() == 1 && header->serialize()[1] == 0x4;
+  });
+
+  tester->unitTest("Detached PUS-B header shall keep its fields and no longer follow the shared header.",[] {
+    const auto shared = std::make_shared<PusB>(0x1, 0x4, 0x5, 0x06, 0x0708, 0);
+    CCSDS::Packet packet;
+    packet.setDataFieldHeader(shared);
+    TEST_VOID(packet.setApplicationData({0x01, 0x02}));
+    const auto before = packet.serialize();
+    if (!packet.detachSecondaryHeader()) return false;
+    const auto afterDetach = packet.serialize();
+    *shared = PusB(0x1, 0x9, 0x9, 0x09, 0x0909, 0);
+    return before == afterDetach && packet.serialize() == before;
+  });
+
+  tester->unitTest("Packet deserialization by type shall reject unregistered ids and truncated headers.",[] {
+    const std::vector<std::uint8_t> data{0xFF, 0xFF, 0xc0, 0x00, 0x00, 0x02, 0x1, 0x4, 0x5};
+    CCSDS::Packet packet;
+    if (packet.deserialize(data, static_cast<CCSDS::SecondaryHeaderTypeId>(42)).has_value()) return false;
+    if (packet.deserialize(data, CCSDS::BUFFER_HEADER_TYPE_ID).has_value()) return false;
+    return !packet.deserialize(data, CCSDS::PUSA_TYPE_ID).has_value();
+  });
+
+  tester->unitTest("CRC16 engine shall match the bitwise reference for any configuration and size.", [] {
+    const std::vector<CCSDS::CRC16Config> configs{{}, {0x8005, 0x0000, 0x0000}, {0x1021, 0x1D0F, 0xFFFF}, {0x3D65, 0xABCD, 0x1234}};
+    std::vector<std::uint8_t> data(70000);
+    std::uint32_t seed = 0x12345678;
+    for (auto &byte: data) {
+      seed = seed * 1664525 + 1013904223;
+      byte = static_cast<std::uint8_t>(seed >> 24);
+    }
+    bool res = true;
+    for (const auto &config: configs) {
+      for (const size_t size: {0, 1, 7, 15, 16, 63, 255, 256, 257, 1000, 65535, 70000}) {
+        const std::vector<std::uint8_t> slice(data.begin(), data.begin() + static_cast<std::ptrdiff_t>(size));
+        res &= crc16(slice, config.polynomial, config.initialValue, config.finalXorValue) == referenceCrc16(slice, config);
+      }
+    }
+    return res;
+  });
+
+  tester->unitTest("CRC16 state shall match a single pass when appending, combining and patching.", [] {
+    const CCSDS::CRC16Config config{0x1021, 0x1D0F, 0xFFFF};
+    std::vector<std::uint8_t> data(5000);
+    for (size_t i = 0; i < data.size(); ++i) {
+      data[i] = static_cast<std::uint8_t>(i * 131 + 17);
+    }
+    CCSDS::CRC16State appended(config);
+    appended.append(data.data(), 1234);
+    appended.append(data.data() + 1234, data.size() - 1234);
+    CCSDS::CRC16State first(config);
+    CCSDS::CRC16State second(config);
+    first.append(data.data(), 3001);
+    second.append(data.data() + 3001, data.size() - 3001);
+    first.append(second);
+    const auto expected = referenceCrc16(data, config);
+    if (appended.getValue() != expected || first.getValue() != expected) return false;
+
+    const std::vector<std::uint8_t> patch{0xDE, 0xAD, 0xBE, 0xEF, 0x00, 0x11, 0x22};
+    if (!appended.patch(2500, data.data() + 2500, patch.data(), patch.size())) return false;
+    std::copy(patch.begin(), patch.end(), data.begin() + 2500);
+    if (appended.patch(4999, data.data(), patch.data(), patch.size())) return false;
+    return appended.getValue() == referenceCrc16(data, config) && appended.getSize() == data.size();
+  });
+
+  tester->unitTest("Packet CRC after appending or patching application data shall match a fresh packet.", [] {
+    const std::vector<std::uint8_t> data{0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08};
+    CCSDS::Packet packet;
+    packet.setDataFieldHeader(std::make_shared<PusC>(0x1, 0x4, 0x5, 0x06, std::vector<std::uint8_t>{0x00, 0x00}, 0));
+    TEST_VOID(packet.setApplicationData(data.data(), 4));
+    (void) packet.getCRC();
+    TEST_VOID(packet.appendApplicationData(data.data() + 4, 4));
+    const std::vector<std::uint8_t> patch{0xAA, 0xBB};
+    TEST_VOID(packet.patchApplicationData(3, patch.data(), patch.size()));
+    TEST_VOID(packet.setDataFieldHeader({0x1, 0x4, 0x5, 0x06, 0x12, 0x34, 0x00, 0x00}, "PusC"));
+    if (packet.patchApplicationData(7, patch.data(), patch.size()).has_value()) return false;
+
+    std::vector<std::uint8_t> expectedData(data);
+    std::copy(patch.begin(), patch.end(), expectedData.begin() + 3);
+    CCSDS::Packet expected;
+    TEST_VOID(expected.setDataFieldHeader({0x1, 0x4, 0x5, 0x06, 0x12, 0x34, 0x00, 0x00}, "PusC"));
+    TEST_VOID(expected.setApplicationData(expectedData));
+    return packet.serialize() == expected.serialize();
+  });
+
+  tester->unitTest("CRC16 engine shall match the vector overload when given a pointer and offset.", [] {
+    std::vector<std::uint8_t> data(4096);
+    for (size_t i = 0; i < data.size(); ++i) {
+      data[i] = static_cast<std::uint8_t>(i * 31 + 7);
+    }
+    bool res = true;
+    for (const size_t offset: {1, 3, 9}) {
+      const std::vector<std::uint8_t> slice(data.begin() + static_cast<std::ptrdiff_t>(offset), data.end());
+      res &= crc16(data.data() + offset, data.size() - offset) == crc16(slice);
+    }
+    return res;
+  });
+
+  tester->unitTest("Primary header codec shall round trip at compile time and match Header.", [] {
+    constexpr CCSDS::PrimaryHeader fields{1, 1, 1, 0x5A3, CCSDS::LAST_SEGMENT, 0x2ABC, 1024};
+    constexpr auto bytes = CCSDS::encodePrimaryHeader(fields);
+    static_assert(bytes[0] == 0x3D && bytes[1] == 0xA3 && bytes[2] == 0xAA && bytes[3] == 0xBC);
+    static_assert(CCSDS::decodePrimaryHeader(bytes).APID == 0x5A3);
+    static_assert(CCSDS::decodePrimaryHeader(bytes).sequenceCount == 0x2ABC);
+    static_assert(CCSDS::decodePrimaryHeader(bytes).dataLength == 1024);
+    CCSDS::Header header;
+    header.setData(fields);
+    CCSDS::Header decoded;
+    TEST_VOID(decoded.deserialize(bytes.data(), bytes.size()));
+    return header.serialize() == std::vector<std::uint8_t>(bytes.begin(), bytes.end()) &&
+           decoded.getFullHeader() == header.getFullHeader() &&
+           !decoded.deserialize(bytes.data(), 5).has_value();
+  });
+
+  tester->unitTest("Batched primary header decode shall match the scalar codec for any batch size.", [] {
+    // 21 packets of varying length cover two vector batches and a scalar tail.
+    std::vector<std::uint8_t> buffer;
+    std::vector<std::uint64_t> offsets;
+    for (std::uint16_t i = 0; i < 21; ++i) {
+      offsets.push_back(buffer.size());
+      const CCSDS::PrimaryHeader fields{static_cast<std::uint8_t>(i & 0x7), static_cast<std::uint8_t>(i & 1), 1,
+                                        static_cast<std::uint16_t>(i * 97), static_cast<std::uint8_t>(i & 3),
+                                        static_cast<std::uint16_t>(i * 781), static_cast<std::uint16_t>(i % 5)};
+      const auto header = CCSDS::encodePrimaryHeader(fields);
+      buffer.insert(buffer.end(), header.begin(), header.end());
+      buffer.resize(buffer.size() + i % 5 + 3, 0xEE);
+    }
+    std::vector<std::uint16_t> identification(offsets.size()), sequenceControl(offsets.size()),
+        dataLength(offsets.size());
+    CCSDS::decodePrimaryHeaders(buffer.data(), offsets.data(), offsets.size(), identification.data(),
+                                sequenceControl.data(), dataLength.data());
+    bool res = true;
+    for (std::size_t row = 0; row < offsets.size(); ++row) {
+      const auto fields = CCSDS::decodePrimaryHeader(buffer.data() + offsets[row]);
+      res &= (identification[row] & 0x07FF) == fields.APID && identification[row] >> 13 == fields.versionNumber;
+      res &= sequenceControl[row] >> 14 == fields.sequenceFlags && (sequenceControl[row] & 0x3FFF) == fields.sequenceCount;
+      res &= dataLength[row] == fields.dataLength;
+    }
+    return res;
+  });
+
+  tester->unitTest("Error shall keep a static message and format its context only when printed.", [] {
+    constexpr CCSDS::Error error = CCSDS::Error{CCSDS::VALIDATION_FAILURE, "Validation failure for packet"}
+                                     .withIndex(3).withApid(100);
+    static_assert(error.hasContext(CCSDS::Error::INDEX) && !error.hasContext(CCSDS::Error::EXPECTED));
+    static_assert(sizeof(CCSDS::ResultBool) <= 32);
+    const CCSDS::ResultBool result = error;
+    const CCSDS::Error mismatch = CCSDS::Error{CCSDS::INVALID_DATA, nullptr}.withValues(8, 6);
+    return result.error().code() == CCSDS::VALIDATION_FAILURE &&
+           result.error().text() == "Validation failure for packet" &&
+           result.error().message() == "Validation failure for packet (index 3, APID 100)" &&
+           result.error().index() == 3 && result.error().apid() == 100 &&
+           mismatch.message() == "Data is invalid (expected 8, actual 6)";
+  });
+
   std::cout << std::endl;
 }
@@ -241,6 +241,63 @@ void testGroupManagement(TestManager *tester, const std::string &description) {
     return std::equal(expected.begin(), expected.end(), ret.begin());
   });
 
+  tester->unitTest("Manager shall visit the stored packets in place and size the packets buffer exactly.", [] {
+    CCSDS::Manager manager{};
+    const std::vector<std::uint8_t> packets{
+          0xF7, 0xFF, 0x40, 0x01, 0x00, 0x05, 0x01, 0x02, 0x03, 0x04, 0x05, 0x93, 0x04,
+          0xF7, 0xFF, 0x00, 0x02, 0x00, 0x05, 0x01, 0x02, 0x03, 0x04, 0x05, 0x93, 0x04,
+          0xF7, 0xFF, 0x80, 0x03, 0x00, 0x02, 0x06, 0x07, 0xc7, 0x4e
+        };
+    TEST_VOID(manager.load(packets));
+
+    std::size_t visitedBytes{0};
+    const CCSDS::Packet *firstPacket{nullptr};
+    manager.forEachPacket([&](const CCSDS::Packet &packet) {
+      if (firstPacket == nullptr) firstPacket = &packet;
+      visitedBytes += packet.getFullPacketLength();
+    });
+    bool res = visitedBytes == packets.size() && firstPacket == &manager.getPacketsReference().front();
+
+    manager.setSyncPatternEnable(true);
+    const auto ret = manager.getPacketsBuffer();
+    res &= manager.getPacketsBufferSize() == packets.size() + 12 && ret.size() == manager.getPacketsBufferSize();
+    return res;
+  });
+
+  tester->unitTest("Manager shall locate packet views in place, fields shall be as expected.", [] {
+    CCSDS::Manager manager{};
+    const std::vector<std::uint8_t> buffer{
+      0xF7, 0xFF, 0x40, 0x01, 0x00, 0x05, 0x01, 0x02, 0x03, 0x04, 0x05, 0x93, 0x04,
+      0xF7, 0xFF, 0x80, 0x03, 0x00, 0x02, 0x06, 0x07, 0xc7, 0x4e
+    };
+    std::vector<CCSDS::PacketView> views;
+    TEST_VOID(manager.getPacketViews(buffer.data(), buffer.size(), views));
+    if (views.size() != 2) return false;
+
+    const auto &view = views[1];
+    const auto applicationData = view.getApplicationData();
+    bool res = view.getBytes().data == buffer.data() + 13;
+    res &= view.getAPID() == 0x7FF && view.getSequenceFlags() == CCSDS::LAST_SEGMENT;
+    res &= view.getSequenceCount() == 3 && view.getDataLength() == 2;
+    res &= applicationData.size == 2 && applicationData[0] == 0x06 && applicationData[1] == 0x07;
+    res &= view.getCRC() == 0xc74e && view.computeCRC() == view.getCRC();
+
+    CCSDS::Packet packet;
+    TEST_VOID(packet.deserialize(view));
+    const auto serialized = packet.serialize();
+    return res && std::equal(serialized.begin(), serialized.end(), buffer.begin() + 13);
+  });
+
+  tester->unitTest("Manager shall reject a truncated last packet.", [] {
+    CCSDS::Manager manager{};
+    const std::vector<std::uint8_t> buffer{
+      0xF7, 0xFF, 0x40, 0x01, 0x00, 0x05, 0x01, 0x02, 0x03, 0x04, 0x05, 0x93, 0x04,
+      0xF7, 0xFF, 0x80, 0x03, 0x00, 0x02, 0x06, 0x07
+    };
+    TEST_VOID_ERR(manager.load(buffer));
+    return true;
+  });
+
   {
     CCSDS::Manager manager{};
     const std::vector<std::uint8_t> buffer{
@@ -374,6 +431,92 @@ void testGroupManagement(TestManager *tester, const std::string &description) {
       return std::equal(expected.begin(), expected.end(), packetBuffer.begin());
   });
 
+  tester->unitTest("Manager multi-threaded segmentation shall match the serial segmentation.", [] {
+    std::vector<std::uint8_t> data(5000);
+    for (std::size_t i = 0; i < data.size(); ++i) {
+      data[i] = static_cast<std::uint8_t>(i * 7 + 3);
+    }
+    CCSDS::Packet packet;
+    TEST_VOID(packet.setPrimaryHeader({0xCF, 0xF4, 0x40, 0x00, 0x00, 0x00}));
+    packet.setDataFieldHeader(std::make_shared<PusA>(0x2, 0x4, 0x5, 0x06, 0));
+
+    CCSDS::Manager serial(packet);
+    serial.setDataFieldSize(37);
+    TEST_VOID(serial.setApplicationData(data));
+    CCSDS::Manager parallel(packet);
+    parallel.setDataFieldSize(37);
+    parallel.setThreadCount(4);
+    TEST_VOID(parallel.setApplicationData(data));
+
+    auto &packets = parallel.getPacketsReference();
+    bool res = parallel.getTotalPackets() == serial.getTotalPackets() && serial.getTotalPackets() > 64;
+    res &= packets.front().getDataFieldHeaderBytes() != packets.back().getDataFieldHeaderBytes();
+    res &= parallel.getPacketsBuffer() == serial.getPacketsBuffer();
+    return res;
+  });
+
+  tester->unitTest("Manager shall index loaded packets by APID and report sequence gaps.", [] {
+    const std::vector<uint8_t> buffer{
+      0xF7, 0xFF, 0x40, 0x01, 0x00, 0x05, 0x01, 0x02, 0x03, 0x04, 0x05, 0x93, 0x04,
+      0xF7, 0xFF, 0x00, 0x02, 0x00, 0x05, 0x01, 0x02, 0x03, 0x04, 0x05, 0x93, 0x04,
+      0xF7, 0xFF, 0x00, 0x03, 0x00, 0x02, 0x06, 0x07, 0xc7, 0x4e,
+      0xF1, 0x23, 0xC0, 0x00, 0x00, 0x02, 0x06, 0x07, 0xc7, 0x4e,
+      0xF7, 0xFF, 0x80, 0x05, 0x00, 0x02, 0x06, 0x07, 0xc7, 0x4e
+    };
+    CCSDS::Manager manager;
+    manager.setPacketIndexEnable(true);
+    TEST_VOID(manager.load(buffer));
+    const auto &index = manager.getPacketIndex();
+    bool res = index.size() == manager.getTotalPackets() && index.size() == 5;
+    res &= index.getOffset(3) == 36 && index.getOffset(4) == 46 && index.getFullPacketLength(0) == 13;
+    res &= index.countAPID(0x7FF) == 4 && index.selectAPID(0x123) == std::vector<std::size_t>{3};
+    res &= index.getSequenceFlags(4) == CCSDS::LAST_SEGMENT && index.getSequenceCount(4) == 5;
+    res &= index.findSequenceGaps(0x7FF) == std::vector<std::size_t>{4};
+    res &= index.findSequenceGaps() == std::vector<std::size_t>{4};
+
+    CCSDS::PacketIndex viewIndex;
+    TEST_VOID(manager.indexPackets(buffer.data(), buffer.size(), viewIndex));
+    res &= viewIndex.getOffsetColumn() == index.getOffsetColumn() &&
+           viewIndex.getSequenceControlColumn() == index.getSequenceControlColumn();
+    res &= !manager.indexPackets(buffer.data(), buffer.size() - 1, viewIndex).has_value();
+    manager.clearPackets();
+    res &= manager.getPacketIndex().empty();
+
+    // packets replaced by new application data are no longer indexed.
+    TEST_VOID(manager.load(buffer));
+    CCSDS::Packet templatePacket;
+    TEST_VOID(templatePacket.setPrimaryHeader({0xF7, 0xFF, 0xC0, 0x00, 0x00, 0x00}));
+    TEST_VOID(manager.setPacketTemplate(templatePacket));
+    TEST_VOID(manager.setApplicationData({0x01, 0x02, 0x03}));
+    return res && manager.getTotalPackets() == 1 && manager.getPacketIndex().empty();
+  });
+
+  tester->unitTest("Manager shall recycle cleared packets up to the pool size and load into them.", [] {
+    const std::vector<uint8_t> first{
+      0xF7, 0xFF, 0x40, 0x01, 0x00, 0x05, 0x01, 0x02, 0x03, 0x04, 0x05, 0x93, 0x04,
+      0xF7, 0xFF, 0x00, 0x02, 0x00, 0x05, 0x01, 0x02, 0x03, 0x04, 0x05, 0x93, 0x04,
+      0xF7, 0xFF, 0x80, 0x03, 0x00, 0x02, 0x06, 0x07, 0xc7, 0x4e
+    };
+    const std::vector<uint8_t> second{
+      0xF7, 0xFF, 0x80, 0x03, 0x00, 0x02, 0x06, 0x07, 0xc7, 0x4e,
+      0xF7, 0xFF, 0x40, 0x01, 0x00, 0x05, 0x01, 0x02, 0x03, 0x04, 0x05, 0x93, 0x04
+    };
+    CCSDS::Manager manager;
+    manager.setPacketPoolSize(2);
+    TEST_VOID(manager.load(first));
+    manager.clearPackets();
+    bool res = manager.getPooledPackets() == 2 && manager.getTotalPackets() == 0;
+    TEST_VOID(manager.load(second));
+    res &= manager.getPooledPackets() == 0 && manager.getPacketsBuffer() == second;
+    manager.clearPackets();
+    TEST_VOID(manager.load(first));
+    res &= manager.getPacketsBuffer() == first;
+    manager.clearPackets();
+    manager.setPacketPoolSize(0);
+    res &= manager.getPooledPackets() == 0;
+    return res;
+  });
+
   {
     CCSDS::Manager manager1{};
     const std::vector<uint8_t> expected{
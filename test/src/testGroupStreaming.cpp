@@ -0,0 +1,405 @@
+// Copyright 2025-2026 ExoSpaceLabs
+// SPDX-License-Identifier: Apache-2.0
+
+#include <algorithm>
+#include <cstdio>
+#include <cstdlib>
+#include <iostream>
+#include "CCSDSCaptureIndex.h"
+#include "CCSDSDemultiplexer.h"
+#include "CCSDSManager.h"
+#include "CCSDSReassembler.h"
+#include "CCSDSStreamDecoder.h"
+#include "CCSDSStreamEncoder.h"
+#include "CCSDSUtils.h"
+#include "PusServices.h"
+#include "CCSDSResult.h"
+#include "tests.h"
+
+namespace {
+  const std::vector<std::uint8_t> syncedPackets{
+    0x1A, 0xCF, 0xFC, 0x1D, 0xF7, 0xFF, 0x40, 0x01, 0x00, 0x05, 0x01, 0x02, 0x03, 0x04, 0x05, 0x93, 0x04,
+    0x1A, 0xCF, 0xFC, 0x1D, 0xF7, 0xFF, 0x00, 0x02, 0x00, 0x05, 0x01, 0x02, 0x03, 0x04, 0x05, 0x93, 0x04,
+    0x1A, 0xCF, 0xFC, 0x1D, 0xF7, 0xFF, 0x80, 0x03, 0x00, 0x02, 0x06, 0x07, 0xc7, 0x4e
+  };
+
+  /** pulls every available packet from the decoder, appending a copy of its bytes. */
+  CCSDS::ResultBool drain(CCSDS::StreamDecoder &decoder, std::vector<std::vector<std::uint8_t>> &packets) {
+    CCSDS::PacketView view;
+    bool packetFound{false};
+    ASSIGN_CP(packetFound, decoder.next(view));
+    while (packetFound) {
+      packets.push_back(view.getBytes().toVector());
+      ASSIGN_CP(packetFound, decoder.next(view));
+    }
+    return true;
+  }
+
+  /** syncedPackets with a corrupt region in front of the first and the second packet. */
+  std::vector<std::uint8_t> corruptedPackets() {
+    const std::vector<std::uint8_t> leading{0x00, 0x1A, 0xCF, 0xFC, 0x00, 0x1D, 0x55};
+    const std::vector<std::uint8_t> middle{0x1A, 0x1A, 0xCF, 0xFC, 0x1C, 0xFF, 0xFF, 0xFF, 0x1A, 0xCF};
+    const std::size_t split = std::min<std::size_t>(17, syncedPackets.size());
+    const std::vector<std::uint8_t> first(syncedPackets.begin(), syncedPackets.begin() + split);
+    const std::vector<std::uint8_t> rest(syncedPackets.begin() + split, syncedPackets.end());
+
+    std::vector<std::uint8_t> buffer;
+    buffer.reserve(leading.size() + first.size() + middle.size() + rest.size());
+    for (const auto *part : {&leading, &first, &middle, &rest}) {
+      buffer.insert(buffer.end(), part->begin(), part->end());
+    }
+    return buffer;
+  }
+
+  /** appends a synced PUS-C packet with a 4 bytes time code, the CRC is not computed. */
+  void appendPusPacket(std::vector<std::uint8_t> &buffer, const std::uint16_t apid, const std::uint16_t count,
+                       const std::uint8_t service, const std::uint32_t timeCode) {
+    const std::vector<std::uint8_t> dataField{
+      0x20, service, 0x01, 0x07, static_cast<std::uint8_t>(timeCode >> 24), static_cast<std::uint8_t>(timeCode >> 16),
+      static_cast<std::uint8_t>(timeCode >> 8), static_cast<std::uint8_t>(timeCode), 0x00, 0x02, 0xAB, 0xCD
+    };
+    buffer.insert(buffer.end(), {0x1A, 0xCF, 0xFC, 0x1D});
+    buffer.insert(buffer.end(), {static_cast<std::uint8_t>(0x08 | apid >> 8), static_cast<std::uint8_t>(apid),
+                                 static_cast<std::uint8_t>(0xC0 | count >> 8), static_cast<std::uint8_t>(count),
+                                 0x00, static_cast<std::uint8_t>(dataField.size())});
+    buffer.insert(buffer.end(), dataField.begin(), dataField.end());
+    buffer.insert(buffer.end(), {0x00, 0x00});
+  }
+}
+
+void testGroupStreaming(TestManager *tester, const std::string &description) {
+  std::cout << "  testGroupStreaming: " << description << std::endl;
+
+  tester->unitTest("StreamDecoder shall decode packets pushed one byte at a time.", [] {
+    CCSDS::StreamDecoder decoder;
+    decoder.setSyncPatternEnable(true);
+    std::vector<std::vector<std::uint8_t>> packets;
+    for (const auto &byte: syncedPackets) {
+      decoder.push(&byte, 1);
+      TEST_VOID(drain(decoder, packets));
+    }
+    bool res = packets.size() == 3 && decoder.getBufferedBytes() == 0;
+    res &= packets[2] == std::vector<std::uint8_t>{0xF7, 0xFF, 0x80, 0x03, 0x00, 0x02, 0x06, 0x07, 0xc7, 0x4e};
+    return res;
+  });
+
+  tester->unitTest("StreamDecoder shall reassemble packets split across two chunks at any offset.", [] {
+    bool res = true;
+    for (size_t split = 1; split < syncedPackets.size(); ++split) {
+      CCSDS::StreamDecoder decoder;
+      decoder.setSyncPatternEnable(true);
+      std::vector<std::vector<std::uint8_t>> packets;
+      decoder.push(syncedPackets.data(), split);
+      TEST_VOID(drain(decoder, packets));
+      decoder.push(syncedPackets.data() + split, syncedPackets.size() - split);
+      TEST_VOID(drain(decoder, packets));
+      res &= packets.size() == 3 && decoder.getPacketCount() == 3;
+      res &= packets[1] == std::vector<std::uint8_t>(syncedPackets.begin() + 21, syncedPackets.begin() + 34);
+    }
+    return res;
+  });
+
+  tester->unitTest("StreamDecoder shall keep a truncated packet buffered until completed.", [] {
+    CCSDS::StreamDecoder decoder;
+    std::vector<std::vector<std::uint8_t>> packets;
+    decoder.push(syncedPackets.data() + 4, 10);
+    TEST_VOID(drain(decoder, packets));
+    return packets.empty() && decoder.getBufferedBytes() == 10;
+  });
+
+  tester->unitTest("StreamDecoder shall fail on a sync pattern mismatch.", [] {
+    CCSDS::StreamDecoder decoder;
+    decoder.setSyncPatternEnable(true);
+    decoder.push(syncedPackets.data() + 1, syncedPackets.size() - 1);
+    CCSDS::PacketView view;
+    TEST_VOID_ERR(decoder.next(view));
+    return true;
+  });
+
+  tester->unitTest("StreamDecoder findSyncPattern shall find the first match at any offset of any buffer size.", [] {
+    bool res = true;
+    for (size_t size = 0; size < 80; ++size) {
+      for (size_t offset = 0; offset <= size; ++offset) {
+        std::vector<std::uint8_t> buffer(size, 0x1A);
+        if (offset + 4 <= size) {
+          buffer[offset + 1] = 0xCF;
+          buffer[offset + 2] = 0xFC;
+          buffer[offset + 3] = 0x1D;
+        }
+        const size_t expected = offset + 4 <= size ? offset : size;
+        res &= CCSDS::StreamDecoder::findSyncPattern(buffer.data(), buffer.size(), 0x1ACFFC1D) == expected;
+      }
+    }
+    return res;
+  });
+
+  tester->unitTest("StreamDecoder shall skip and count corrupt regions when resynchronising.", [] {
+    const auto buffer = corruptedPackets();
+    bool res = true;
+    for (size_t split = 1; split < buffer.size(); ++split) {
+      CCSDS::StreamDecoder decoder;
+      decoder.setSyncPatternEnable(true);
+      decoder.setResyncEnable(true);
+      std::vector<std::vector<std::uint8_t>> packets;
+      decoder.push(buffer.data(), split);
+      TEST_VOID(drain(decoder, packets));
+      decoder.push(buffer.data() + split, buffer.size() - split);
+      TEST_VOID(drain(decoder, packets));
+      res &= packets.size() == 3 && decoder.getBufferedBytes() == 0;
+      res &= decoder.getSkippedRegions() == 2 && decoder.getSkippedBytes() == 17;
+      res &= packets[2] == std::vector<std::uint8_t>{0xF7, 0xFF, 0x80, 0x03, 0x00, 0x02, 0x06, 0x07, 0xc7, 0x4e};
+    }
+    return res;
+  });
+
+  tester->unitTest("Manager shall load corrupted buffers when resynchronisation is enabled.", [] {
+    auto buffer = corruptedPackets();
+    buffer.insert(buffer.end(), {0x1A, 0xCF, 0xFC, 0x1D, 0xF7});
+    CCSDS::Manager manager;
+    manager.setSyncPatternEnable(true);
+    std::vector<CCSDS::PacketView> views;
+    TEST_VOID_ERR(manager.getPacketViews(buffer.data(), buffer.size(), views));
+    views.clear();
+    manager.setResyncEnable(true);
+    TEST_VOID(manager.getPacketViews(buffer.data(), buffer.size(), views));
+    return views.size() == 3 && manager.getSkippedRegions() == 3 && manager.getSkippedBytes() == 22;
+  });
+
+  tester->unitTest("Reassembler shall ignore duplicates and drop units with gaps, timeouts or overflows.", [] {
+    std::vector<std::vector<std::uint8_t>> units;
+    CCSDS::Reassembler reassembler([&units](std::uint16_t, const std::uint8_t *pData, const std::size_t size) {
+      units.emplace_back(pData, pData + size);
+    });
+    reassembler.setTimeout(10);
+    reassembler.setMaxUnitSize(6);
+    const std::uint8_t data[] = {1, 2, 3, 4};
+    // complete unit with a duplicated middle segment, interleaved with an unsegmented packet of another APID.
+    TEST_VOID(reassembler.add(0x10, CCSDS::FIRST_SEGMENT, 1, data, 2, 0));
+    TEST_VOID(reassembler.add(0x10, CCSDS::CONTINUING_SEGMENT, 2, data + 2, 1, 1));
+    TEST_VOID(reassembler.add(0x20, CCSDS::UNSEGMENTED, 0, data, 4, 2));
+    TEST_VOID(reassembler.add(0x10, CCSDS::CONTINUING_SEGMENT, 2, data + 2, 1, 3));
+    TEST_VOID(reassembler.add(0x10, CCSDS::LAST_SEGMENT, 3, data + 3, 1, 4));
+    bool res = units.size() == 2 && units[1] == std::vector<std::uint8_t>{1, 2, 3, 4};
+    // gap: segment 6 is missing, the unit and the segments up to the next FIRST are dropped.
+    TEST_VOID(reassembler.add(0x10, CCSDS::FIRST_SEGMENT, 5, data, 1, 5));
+    TEST_VOID(reassembler.add(0x10, CCSDS::CONTINUING_SEGMENT, 7, data, 1, 6));
+    TEST_VOID(reassembler.add(0x10, CCSDS::LAST_SEGMENT, 8, data, 1, 7));
+    // timeout: the continuation arrives too late.
+    TEST_VOID(reassembler.add(0x10, CCSDS::FIRST_SEGMENT, 9, data, 1, 8));
+    TEST_VOID(reassembler.add(0x10, CCSDS::LAST_SEGMENT, 10, data, 1, 30));
+    // overflow: the unit exceeds the 6 bytes limit.
+    TEST_VOID(reassembler.add(0x10, CCSDS::FIRST_SEGMENT, 11, data, 4, 31));
+    TEST_VOID(reassembler.add(0x10, CCSDS::LAST_SEGMENT, 12, data, 4, 32));
+    const auto &statistics = reassembler.getStatistics();
+    res &= units.size() == 2 && statistics.duplicateSegments == 1 && statistics.timedOutUnits == 1;
+    res &= statistics.overflowUnits == 1 && statistics.droppedSegments == 7;
+    res &= reassembler.getStatistics(0x20).completedUnits == 1 && reassembler.getStatistics(0x10).completedBytes == 4;
+    return res && reassembler.getPendingUnits() == 0 && reassembler.getBufferedBytes() == 0;
+  });
+
+  tester->unitTest("Reassembler shall evict the least recently updated units above the memory limit.", [] {
+    std::vector<std::uint16_t> completed;
+    CCSDS::Reassembler reassembler([&completed](const std::uint16_t apid, const std::uint8_t *, std::size_t) {
+      completed.push_back(apid);
+    });
+    reassembler.setMemoryLimit(8);
+    const std::uint8_t data[] = {1, 2, 3, 4};
+    TEST_VOID(reassembler.add(0x1, CCSDS::FIRST_SEGMENT, 1, data, 4, 0));
+    TEST_VOID(reassembler.add(0x2, CCSDS::FIRST_SEGMENT, 1, data, 4, 1));
+    TEST_VOID(reassembler.add(0x3, CCSDS::FIRST_SEGMENT, 1, data, 4, 2));
+    bool res = reassembler.getStatistics(0x1).overflowUnits == 1 && reassembler.getBufferedBytes() == 8;
+    TEST_VOID(reassembler.add(0x2, CCSDS::LAST_SEGMENT, 2, data, 2, 3));
+    res &= completed == std::vector<std::uint16_t>{0x2} && reassembler.getStatistics(0x3).overflowUnits == 1;
+    TEST_VOID(reassembler.add(0x1, CCSDS::LAST_SEGMENT, 2, data, 2, 4));
+    res &= reassembler.getStatistics(0x1).droppedSegments == 2 && completed.size() == 1;
+    return res && reassembler.getBufferedBytes() == 0 && reassembler.getPendingUnits() == 0;
+  });
+
+  tester->unitTest("Demultiplexer shall route interleaved APIDs to their sinks and reassemble segments.", [] {
+    std::vector<std::uint8_t> dataA(100);
+    for (std::size_t i = 0; i < dataA.size(); ++i) {
+      dataA[i] = static_cast<std::uint8_t>(i * 3 + 1);
+    }
+    CCSDS::Packet templateA;
+    TEST_VOID(templateA.setPrimaryHeader({0x09, 0x00, 0x40, 0x00, 0x00, 0x00}));
+    templateA.setDataFieldHeader(std::make_shared<PusA>(0x1, 0x2, 0x3, 0x04, 0));
+    CCSDS::Manager managerA(templateA);
+    managerA.setDataFieldSize(26);
+    TEST_VOID(managerA.setApplicationData(dataA));
+
+    CCSDS::Packet templateB;
+    TEST_VOID(templateB.setPrimaryHeader({0x02, 0x00, 0xC0, 0x00, 0x00, 0x00}));
+    CCSDS::Manager managerB(templateB);
+    const std::vector<std::uint8_t> dataB{0xB0, 0xB1, 0xB2};
+    TEST_VOID(managerB.setApplicationData(dataB));
+
+    // A packets interleaved with B and an unknown APID, then a second A sequence missing a segment.
+    const auto packetB = managerB.getPacketsReference().front().serialize();
+    const std::vector<std::uint8_t> packetUnknown{0x03, 0x00, 0xC0, 0x00, 0x00, 0x01, 0xEE, 0x00, 0x00};
+    std::vector<std::uint8_t> buffer;
+    for (auto &packet : managerA.getPacketsReference()) {
+      const auto bytes = packet.serialize();
+      buffer.insert(buffer.end(), bytes.begin(), bytes.end());
+      buffer.insert(buffer.end(), packetB.begin(), packetB.end());
+    }
+    buffer.insert(buffer.end(), packetUnknown.begin(), packetUnknown.end());
+    TEST_VOID(managerA.setApplicationData(dataA));
+    auto &sequence = managerA.getPacketsReference();
+    for (std::size_t index = 0; index < sequence.size(); ++index) {
+      if (index != 1) {
+        const auto bytes = sequence[index].serialize();
+        buffer.insert(buffer.end(), bytes.begin(), bytes.end());
+      }
+    }
+
+    std::vector<std::uint8_t> outputA;
+    std::vector<std::uint8_t> outputB;
+    CCSDS::Demultiplexer demux;
+    TEST_VOID(demux.addChannel(templateA, [&](std::uint16_t, const std::uint8_t *pData, const std::size_t size) {
+      outputA.insert(outputA.end(), pData, pData + size);
+    }));
+    TEST_VOID(demux.addChannel(0x200, [&](std::uint16_t, const std::uint8_t *pData, const std::size_t size) {
+      outputB.insert(outputB.end(), pData, pData + size);
+    }));
+    // fed in two chunks splitting a packet.
+    TEST_VOID(demux.push(buffer.data(), 50));
+    TEST_VOID(demux.push(buffer.data() + 50, buffer.size() - 50));
+    TEST_VOID(demux.finish());
+
+    CCSDS::DemuxChannelStatistics statisticsA;
+    TEST_RET(statisticsA, demux.getChannelStatistics(0x100));
+    const auto segments = sequence.size();
+    bool res = outputA == dataA && statisticsA.reassembly.completedUnits == 1 &&
+               statisticsA.reassembly.droppedSegments == segments - 1;
+    std::vector<std::uint8_t> expectedB;
+    for (std::size_t i = 0; i < segments; ++i) {
+      expectedB.insert(expectedB.end(), dataB.begin(), dataB.end());
+    }
+    res &= outputB == expectedB && demux.getUnroutedPackets() == 1;
+    return res && demux.getChannels() == std::vector<std::uint16_t>{0x100, 0x200};
+  });
+
+  tester->unitTest("StreamEncoder shall encode chunks in any order identically to the Manager segmentation.", [] {
+    std::vector<std::uint8_t> data(1000);
+    for (std::size_t i = 0; i < data.size(); ++i) {
+      data[i] = static_cast<std::uint8_t>(i * 11 + 5);
+    }
+    CCSDS::Packet packet;
+    TEST_VOID(packet.setPrimaryHeader({0xCF, 0xF4, 0x40, 0x00, 0x00, 0x00}));
+    packet.setDataFieldHeader(std::make_shared<PusA>(0x2, 0x4, 0x5, 0x06, 0));
+
+    CCSDS::Manager manager(packet);
+    manager.setDataFieldSize(37);
+    manager.setSyncPatternEnable(true);
+    TEST_VOID(manager.setApplicationData(data));
+    const auto expected = manager.getPacketsBuffer();
+
+    CCSDS::StreamEncoder encoder;
+    TEST_VOID(encoder.setTemplate(manager.getTemplate()));
+    encoder.setSyncPatternEnable(true);
+    TEST_VOID(encoder.begin(data.size()));
+    const std::size_t chunkSize = encoder.getMaxBytesPerPacket() * 4;
+    std::vector<std::vector<std::uint8_t>> chunks((data.size() + chunkSize - 1) / chunkSize);
+    for (std::size_t chunk = chunks.size(); chunk-- > 0;) {
+      const std::size_t offset = chunk * chunkSize;
+      TEST_VOID(encoder.encode(offset, data.data() + offset, std::min(chunkSize, data.size() - offset), chunks[chunk]));
+    }
+    std::vector<std::uint8_t> encoded;
+    for (const auto &chunk : chunks) {
+      encoded.insert(encoded.end(), chunk.begin(), chunk.end());
+    }
+    const bool misaligned = !encoder.encode(1, data.data() + 1, 10, encoded).has_value();
+    return encoded == expected && encoder.getEncodedSize() == expected.size() &&
+           encoder.getPacketCount() == manager.getTotalPackets() && encoder.isConcurrent() && misaligned;
+  });
+
+  tester->unitTest("CaptureIndex shall index a capture in one pass and serve its packets by row, APID and time.", [] {
+    std::vector<std::uint8_t> capture;
+    for (std::uint16_t i = 0; i < 30; ++i) {
+      appendPusPacket(capture, i % 3 == 0 ? 0x123 : 0x045, i, static_cast<std::uint8_t>(i % 3 == 0 ? 3 : 1), 1000 + i * 10);
+    }
+    appendPusPacket(capture, 0x7FF, 0, 17, 2000);
+    TEST_VOID(writeBinaryFile(capture, "test_resources/capture.bin"));
+
+    CCSDS::CaptureIndexBuilder builder;
+    builder.setSyncPatternEnable(true);
+    builder.setPusEnable(true);
+    TEST_VOID(builder.setTimeCodeSize(4));
+    TEST_VOID_ERR(builder.setTimeCodeSize(9));
+    TEST_VOID(builder.build("test_resources/capture.bin", "test_resources/capture.idx"));
+
+    CCSDS::CaptureIndexReader reader;
+    TEST_VOID(reader.open("test_resources/capture.idx"));
+    bool res = reader.size() == 31 && builder.getPacketCount() == 31 && reader.getHeader().timeCodeSize == 4;
+    const auto &record = reader[6];
+    res &= record.offset == 6 * 24 + 4 && record.getAPID() == 0x123 && record.getSequenceCount() == 6 &&
+           record.getSequenceFlags() == 3 && record.service == 3 && record.subtype == 1 && record.timeCode == 1060;
+    res &= reader.countAPID(0x123) == 10 && reader.selectAPID(0x123, 10, 20) == std::vector<std::size_t>{12, 15, 18};
+    res &= reader.lowerBoundTimeCode(1055) == 6 && reader.lowerBoundTimeCode(5000) == 31;
+    TEST_VOID_ERR(reader.getRecord(31));
+
+    CCSDS::PacketView view;
+    TEST_VOID_ERR(reader.getPacket(0, view));
+    TEST_VOID(reader.openCapture("test_resources/capture.bin"));
+    TEST_VOID(reader.getPacket(30, view));
+    res &= view.getBytes().toVector() == std::vector<std::uint8_t>(capture.end() - 20, capture.end());
+    return res && view.getAPID() == 0x7FF;
+  });
+
+  tester->unitTest("CaptureIndex shall reject truncated captures, stale captures and corrupt indexes.", [] {
+    std::vector<std::uint8_t> capture;
+    appendPusPacket(capture, 0x123, 0, 3, 1000);
+    appendPusPacket(capture, 0x123, 1, 3, 1010);
+    TEST_VOID(writeBinaryFile(capture, "test_resources/capture.bin"));
+    CCSDS::CaptureIndexBuilder builder;
+    builder.setSyncPatternEnable(true);
+    TEST_VOID(builder.build("test_resources/capture.bin", "test_resources/capture.idx"));
+
+    // the capture grew after indexing.
+    appendPusPacket(capture, 0x123, 2, 3, 1020);
+    TEST_VOID(writeBinaryFile(capture, "test_resources/capture.bin"));
+    CCSDS::CaptureIndexReader reader;
+    TEST_VOID(reader.open("test_resources/capture.idx"));
+    TEST_VOID_ERR(reader.openCapture("test_resources/capture.bin"));
+    bool res = reader[1].timeCode == 0 && reader[1].service == 0;
+
+    std::vector<std::uint8_t> index;
+    TEST_RET(index, readBinaryFile("test_resources/capture.idx"));
+    index.pop_back();
+    TEST_VOID(writeBinaryFile(index, "test_resources/capture.idx"));
+    TEST_VOID_ERR(reader.open("test_resources/capture.idx"));
+    index[0] = 'X';
+    TEST_VOID(writeBinaryFile(index, "test_resources/capture.idx"));
+    TEST_VOID_ERR(reader.open("test_resources/capture.idx"));
+
+    capture.pop_back();
+    TEST_VOID_ERR(builder.build(capture.data(), capture.size(), "test_resources/truncated.idx"));
+    return res && !fileExists("test_resources/truncated.idx");
+  });
+
+#ifdef CCSDSPACK_TEST_DECODER
+  tester->unitTest("ccsds_decoder stream demux shall remove the APID outputs of a truncated input.", [] {
+    CCSDS::Manager manager;
+    TEST_VOID(manager.loadTemplateConfigFile("test_resources/config.cfg"));
+    TEST_VOID(manager.setApplicationData(std::vector<std::uint8_t>(5000, 0x5A)));
+    const auto unit = manager.getPacketsBuffer();
+    std::vector<std::uint8_t> capture(unit);
+    capture.insert(capture.end(), unit.begin(), unit.end() - 3); // the second unit ends inside its last packet.
+    TEST_VOID(writeBinaryFile(capture, "test_resources/demux_truncated.bin"));
+
+    const std::string apidOutput = "test_resources/demux_out_apid" + std::to_string(manager.getTemplate().getPrimaryHeader().getAPID()) + ".bin";
+    std::remove(apidOutput.c_str());
+#ifdef _WIN32
+    const std::string command = "ccsds_decoder.exe -s -d -i test_resources/demux_truncated.bin "
+                                "-o test_resources/demux_out.bin -c test_resources/config.cfg > NUL 2>&1";
+#else
+    const std::string command = "./ccsds_decoder -s -d -i test_resources/demux_truncated.bin "
+                                "-o test_resources/demux_out.bin -c test_resources/config.cfg > /dev/null 2>&1";
+#endif
+    const int status = std::system(command.c_str());
+    return status != 0 && !fileExists(apidOutput) && !fileExists("test_resources/demux_out.bin");
+  });
+#endif
+
+  std::cout << std::endl;
+}
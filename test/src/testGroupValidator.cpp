@@ -1,6 +1,7 @@
 // Copyright 2025-2026 ExoSpaceLabs
 // SPDX-License-Identifier: Apache-2.0
 
+#include <CCSDSManager.h>
 #include <CCSDSValidator.h>
 #include <iostream>
 #include "CCSDSUtils.h"
@@ -47,6 +48,25 @@ void testGroupValidator(TestManager *tester, const std::string &description) {
     return validator.validate(packet);
   });
 
+  tester->unitTest("Validator shall report the same results for a packet view and its packet.", []() {
+    CCSDS::Validator packetValidator;
+    CCSDS::Validator viewValidator;
+    packetValidator.configure(true, true, false);
+    viewValidator.configure(true, true, false);
+    const std::vector<std::uint8_t> packetData{
+      0xFF, 0xFF, 0x40, 0x02, 0x00, 0x05, 0x01, 0x02, 0x03, 0x04, 0x05, 0x93, 0x05
+    };
+    CCSDS::Packet packet;
+    packet.setUpdatePacketEnable(false);
+    TEST_VOID(packet.deserialize(packetData));
+    CCSDS::PacketView view;
+    TEST_VOID(view.deserialize(packetData));
+
+    const bool packetResult = packetValidator.validate(packet);
+    const bool viewResult = viewValidator.validate(view);
+    return packetResult == viewResult && !viewResult && packetValidator.getReport() == viewValidator.getReport();
+  });
+
   tester->unitTest("Validator SEGMENTED Packet coherence shall fail.", []() {
     CCSDS::Validator validator;
     validator.configure(true, true, false);
@@ -445,6 +465,83 @@ void testGroupValidator(TestManager *tester, const std::string &description) {
   });
 
 
+  tester->unitTest("Validator multi-threaded batch validation shall match validating each packet in turn.", []() {
+    std::vector<std::uint8_t> data(8000);
+    for (std::size_t i = 0; i < data.size(); ++i) {
+      data[i] = static_cast<std::uint8_t>(i * 5 + 1);
+    }
+    CCSDS::Manager manager;
+    TEST_VOID(manager.setPacketTemplate(CCSDS::Packet{}));
+    manager.setDataFieldSize(20);
+    TEST_VOID(manager.setApplicationData(data));
+    auto buffer = manager.getPacketsBuffer();
+    const auto packetSize = manager.getPacketsReference().front().getFullPacketLength();
+    buffer[packetSize + 10] ^= 0xFF; // corrupts the application data of the second packet, CRC mismatch.
+    buffer[2 * packetSize + 3]++;    // breaks the sequence count of the third packet.
+
+    std::vector<CCSDS::PacketView> views;
+    TEST_VOID(manager.getPacketViews(buffer.data(), buffer.size(), views));
+    CCSDS::Validator serial;
+    CCSDS::Validator batch;
+    serial.configure(true, true, false);
+    batch.configure(true, true, false);
+    batch.setThreadCount(4);
+
+    bool serialResult{true};
+    std::vector<std::vector<bool>> serialReports;
+    for (const auto &view : views) {
+      serialResult &= serial.validate(view);
+      serialReports.push_back(serial.getReport());
+    }
+    const bool batchResult = batch.validateAll(views);
+    return views.size() > 256 && !batchResult && batchResult == serialResult && batch.getReports() == serialReports &&
+           batch.getReport() == serial.getReport();
+  });
+
+  tester->unitTest("Validator SEGMENTED Packets sequence shall pass across the sequence count wrap.", []() {
+    const std::vector<std::uint8_t> data(16400, 0x5A);
+    CCSDS::Manager manager;
+    TEST_VOID(manager.setPacketTemplate(CCSDS::Packet{}));
+    manager.setDataFieldSize(1);
+    TEST_VOID(manager.setApplicationData(data));
+    const auto buffer = manager.getPacketsBuffer();
+
+    std::vector<CCSDS::PacketView> views;
+    TEST_VOID(manager.getPacketViews(buffer.data(), buffer.size(), views));
+    CCSDS::Validator validator;
+    validator.configure(true, true, false);
+    bool result{true};
+    for (const auto &view : views) {
+      result &= validator.validate(view);
+    }
+    return views.size() == data.size() && views[16383].getSequenceCount() == 0 && result;
+  });
+
+  tester->unitTest("Manager template loaded from configuration shall reject a coherent packet of another APID.", []() {
+    CCSDS::Manager encoder;
+    TEST_VOID(encoder.loadTemplateConfigFile("test_resources/templatePacket.cfg"));
+    TEST_VOID(encoder.setApplicationData(std::vector<std::uint8_t>(3000, 0x5A)));
+    auto buffer = encoder.getPacketsBuffer();
+    buffer[1] ^= 0x01; // APID of the first segment differs from the template, length, CRC and count still hold.
+
+    std::vector<CCSDS::PacketView> views;
+    CCSDS::Manager streamDecoder;
+    TEST_VOID(streamDecoder.loadTemplateConfigFile("test_resources/templatePacket.cfg"));
+    TEST_VOID(streamDecoder.getPacketViews(buffer.data(), buffer.size(), views));
+    CCSDS::Validator coherence;
+    const bool coherent = views.size() == 3 && coherence.validate(views.front());
+    const bool streamValid = streamDecoder.getValidatorReference().validate(views.front());
+    const std::vector<bool> expected{true, true, true, true, false, true};
+    const bool onlyTemplateFails = streamDecoder.getValidatorReference().getReport() == expected;
+
+    CCSDS::Manager decoder;
+    TEST_VOID(decoder.loadTemplateConfigFile("test_resources/templatePacket.cfg"));
+    TEST_VOID(decoder.load(buffer));
+    const auto res = decoder.getApplicationDataBuffer();
+    return coherent && !streamValid && onlyTemplateFails && !res.has_value() &&
+           res.error().code() == CCSDS::ErrorCode::VALIDATION_FAILURE;
+  });
+
   tester->unitTest("Validator shall clear its variables.", []() {
     CCSDS::Validator validator;
     validator.configure(true, true, true);
@@ -23,5 +23,8 @@ int main() {
   // perform edge cases tests on the library
   testGroupEdgeCases(&tester, "Edge cases and detailed PUS checks.");
 
+  // perform stream decoding tests on the library
+  testGroupStreaming(&tester, "Incremental decoding of CCSDS packet streams.");
+
   return tester.Result();
 }